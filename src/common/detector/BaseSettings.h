@@ -26,14 +26,26 @@ struct BaseSettings {
   int32_t  RxSocketBufferSize   {2000000}; // bytes
   int32_t  TxSocketBufferSize   {2000000}; // bytes
   int32_t  SocketRxTimeoutUS    {100}; // wait only 100us for data on socket
+  uint32_t RxBatchSize          {1};   // > 1 receives with recvmmsg()
+  uint32_t RxThreads            {1};   // > 1 uses SO_REUSEPORT sockets
+  std::string   RxBackend       {"udp"}; // "udp" or "packet_mmap"
+  std::string   RxInterface     {""};    // network interface for packet_mmap
+  std::string   ProcessingWait  {"adaptive"}; // "sleep", "spin" or "adaptive"
+  uint32_t ProcessingWaitTimeoutUS {1000}; // max block time for "adaptive"
+  uint32_t ProcessingWorkers    {1};   // > 1 shards packets over workers (CAEN)
   /// /brief Monitoring
   uint32_t MonitorPeriod        {1000};  // start capturing every 1000 packets
   uint32_t MonitorSamples       {2};     // capture 2 consecutive packets
+  // > 0 packs length prefixed packets per ar51 message, these messages
+  // have AR51Serializer::BatchSuffix appended to their source_name
+  uint32_t MonitorBatchBytes    {0};
+  uint32_t MonitorBatchMS       {100};   // max wait of a batched packet
   ///\brief Kafka settings
   std::string   KafkaConfigFile {""}; // use default
   std::string   KafkaBroker     {"localhost:9092"};
   std::string   KafkaTopic      {""};
   std::string   KafkaDebugTopic {""};
+  bool          KafkaThread     {false}; // poll/produce in a producer thread
   ///\brief Graphite setting
   std::string   GraphitePrefix  {""};
   std::string   GraphiteRegion  {"0"};
@@ -44,6 +56,7 @@ struct BaseSettings {
   uint32_t      StopAfterSec    {0xffffffffU};
   bool          NoHwCheck       {false};
   std::vector<std::string>  Interfaces {};
+  std::vector<std::string>  ThreadAffinity {}; // "thread:core", e.g. "input:2"
   std::string   CalibFile       {""};
   ///\brief module specific configurations
   // perfgen
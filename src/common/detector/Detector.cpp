@@ -9,8 +9,15 @@
 
 #include <common/debug/TraceGroups.h>
 #include <common/detector/Detector.h>
+#include <common/system/Numa.h>
+#include <common/system/PacketMmapReceiver.h>
 #include <common/system/SocketImpl.h>
 #include <common/time/ESSTime.h>
+#include <common/time/Timer.h>
+#include <algorithm>
+#include <cstring>
+#include <unistd.h>
+#include <vector>
 
 using namespace esstime;
 
@@ -21,74 +28,377 @@ const std::string Detector::METRIC_RECEIVE_DROPPED = "receive.dropped";
 const std::string Detector::METRIC_FIFO_SEQ_ERRORS = "receive.fifo_seq_errors";
 const std::string Detector::METRIC_THREAD_INPUT_IDLE = "thread.input_idle";
 const std::string Detector::METRIC_PRODUCE_MONITOR_PACKETS = "produce.cause.monitor_packets";
+const std::string Detector::METRIC_RECEIVE_BATCHES = "receive.batches";
+const std::string Detector::METRIC_RECEIVE_BATCH_FILL = "receive.batch_fill";
+const std::string Detector::METRIC_RECEIVE_BATCH_FULL = "receive.batch_full";
+const std::string Detector::METRIC_PRODUCE_MONITOR_DROPPED = "produce.cause.monitor_dropped";
+const std::string Detector::METRIC_PRODUCE_MONITOR_MESSAGES = "produce.cause.monitor_messages";
 // clang-format on
 
-void Detector::inputThread() {
-  XTRACE(INPUT, DEB, "Starting inputThread");
+std::vector<std::unique_ptr<Detector::InputQueue>>
+Detector::createInputQueues(const BaseSettings &Settings) {
+  // The packet_mmap backend uses a single ring shared with the kernel
+  size_t Count = Settings.RxBackend == "packet_mmap"
+                     ? 1
+                     : std::max<uint32_t>(1, Settings.RxThreads);
+  std::vector<std::unique_ptr<InputQueue>> Queues;
+  for (size_t i = 0; i < Count; i++) {
+    Queues.emplace_back(std::make_unique<InputQueue>());
+  }
+  return Queues;
+}
+
+void Detector::addInputThreads() {
+  for (size_t i = 0; i < InputQueues.size(); i++) {
+    std::function<void()> inputFunc = [this, i]() { inputThread(i); };
+    AddThreadFunction(inputFunc, i == 0 ? "input" : fmt::format("input_{}", i));
+  }
+  std::function<void()> monitorFunc = [this]() { monitorThread(); };
+  AddThreadFunction(monitorFunc, "monitor");
+}
+
+Detector::InputCounters &Detector::inputCounters(size_t QueueIndex) {
+  // A single input thread counts directly into the registered counters,
+  // otherwise the first thread periodically aggregates the per thread ones
+  if (InputQueues.size() == 1) {
+    return ITCounters;
+  }
+  return InputQueues[QueueIndex]->Counters;
+}
+
+bool Detector::placeInputQueue(size_t QueueIndex, int Node) {
+  if (QueueIndex >= InputQueues.size()) {
+    return false;
+  }
+  auto &Queue = *InputQueues[QueueIndex];
+  bool Moved = Numa::moveToNode(&Queue, sizeof(Queue), Node);
+  Moved = Numa::moveToNode(Queue.Ring.getStorage(), Queue.Ring.getStorageSize(),
+                           Node) and
+          Moved;
+  // Sampled packets are copied by the input thread
+  return Numa::moveToNode(Queue.MonitorRing.getStorage(),
+                          Queue.MonitorRing.getStorageSize(), Node) and
+         Moved;
+}
+
+void Detector::inputThread(size_t QueueIndex) {
+  XTRACE(INPUT, DEB, "Starting inputThread %zu", QueueIndex);
+  if (EFUSettings.RxBackend == "packet_mmap") {
+    receivePacketMmap();
+    XTRACE(INPUT, ALW, "Stopping input thread.");
+    return;
+  }
+
   SocketImpl::Endpoint local(EFUSettings.DetectorAddress.c_str(),
                              EFUSettings.DetectorPort);
 
-  UDPReceiver dataReceiver(local);
+  // With several input threads each binds its own socket to the same
+  // address and port, and the kernel distributes flows across them
+  bool Sharded = InputQueues.size() > 1;
+  UDPReceiver dataReceiver(local, Sharded);
   dataReceiver.setBufferSizes(EFUSettings.TxSocketBufferSize,
                               EFUSettings.RxSocketBufferSize);
   dataReceiver.printBufferSizes();
   dataReceiver.setRecvTimeout(0, EFUSettings.SocketRxTimeoutUS);
 
-  LOG(INIT, Sev::Info, "Detector input thread started on {}:{}",
-      local.IpAddress, local.Port);
+  LOG(INIT, Sev::Info, "Detector input thread {} started on {}:{}",
+      QueueIndex, local.IpAddress, local.Port);
+
+  InputQueue &Queue = *InputQueues[QueueIndex];
+  InputCounters &Counters = inputCounters(QueueIndex);
+  bool Aggregate = Sharded and (QueueIndex == 0);
+
+  int BatchSize = std::min<int>(EFUSettings.RxBatchSize, RxBatchMaxEntries);
+  if (BatchSize > 1) {
+    LOG(INIT, Sev::Info, "Receiving up to {} packets per system call",
+        BatchSize);
+    receiveBatched(dataReceiver, Queue, Counters, Aggregate, BatchSize);
+  } else {
+    receiveSingle(dataReceiver, Queue, Counters, Aggregate);
+  }
+
+  if (Aggregate) {
+    aggregateInputCounters();
+  }
+
+  XTRACE(INPUT, ALW, "Stopping input thread.");
+  return;
+}
+
+void Detector::aggregateInputCounters() {
+  InputCounters Sum;
+  for (auto &Queue : InputQueues) {
+    const InputCounters &C = Queue->Counters;
+    Sum.RxPackets += C.RxPackets;
+    Sum.RxBytes += C.RxBytes;
+    Sum.FifoPushErrors += C.FifoPushErrors;
+    Sum.RxIdle += C.RxIdle;
+    Sum.TxRawReadoutPackets += C.TxRawReadoutPackets;
+    Sum.RxBatches += C.RxBatches;
+    Sum.RxBatchFill = std::max(Sum.RxBatchFill, C.RxBatchFill);
+    Sum.RxBatchFull += C.RxBatchFull;
+    Sum.MonitorDrops += C.MonitorDrops;
+  }
+  static_cast<InputCounters &>(ITCounters) = Sum;
+}
+
+void Detector::receiveSingle(UDPReceiver &dataReceiver, InputQueue &Queue,
+                             InputCounters &Counters, bool Aggregate) {
+  auto &Ring = Queue.Ring;
+  Timer AggregateTimer(AggregateIntervalNS);
 
   while (runThreads) {
 
+    if (Aggregate and AggregateTimer.timeout()) {
+      aggregateInputCounters();
+    }
+
     auto idle_start = local_clock::now();
 
     int readSize;
 
     // Get next buffer from ringbuffer
-    unsigned int rxBufferIndex = RxRingbuffer.getDataIndex();
-    RxRingbuffer.setDataLength(rxBufferIndex, 0);
-    auto DataPtr = RxRingbuffer.getDataBuffer(rxBufferIndex);
+    unsigned int rxBufferIndex = Ring.getDataIndex();
+    Ring.setDataLength(rxBufferIndex, 0);
+    auto DataPtr = Ring.getDataBuffer(rxBufferIndex);
 
-    if ((readSize =
-             dataReceiver.receive(DataPtr, RxRingbuffer.getMaxBufSize())) > 0) {
+    if ((readSize = dataReceiver.receive(DataPtr, Ring.getMaxBufSize())) > 0) {
 
-      RxRingbuffer.setDataLength(rxBufferIndex, readSize);
+      Ring.setDataLength(rxBufferIndex, readSize);
       XTRACE(INPUT, DEB, "Received an udp packet of length %d bytes", readSize);
-      ITCounters.RxPackets++;
-      ITCounters.RxBytes += readSize;
+      Counters.RxPackets++;
+      Counters.RxBytes += readSize;
 
       // Calibration mode send all raw input data to sample topic
       if (CalibrationMode) {
-        MonitorSerializer.serialize((uint8_t *)DataPtr, readSize);
-        MonitorSerializer.produce();
-        ITCounters.TxRawReadoutPackets++;
+        queueMonitorPacket(Queue, Counters, DataPtr, readSize);
         continue;
 
         // Normal operation, send raw data data according to config, for every
         // MonitorPeriod MonitorSamples number of packets parrallel to load data
         // into the ring buffer
-      } else if (ITCounters.RxPackets % EFUSettings.MonitorPeriod <
+      } else if (Counters.RxPackets % EFUSettings.MonitorPeriod <
                  EFUSettings.MonitorSamples) {
         XTRACE(PROCESS, DEB, "Serialize and stream monitor data for packet %lu",
-               getInputCounters().RxPackets);
-        MonitorSerializer.serialize((uint8_t *)DataPtr, readSize);
-        MonitorSerializer.produce();
-        ITCounters.TxRawReadoutPackets++;
+               Counters.RxPackets);
+        queueMonitorPacket(Queue, Counters, DataPtr, readSize);
       }
 
-      if (InputFifo.push(rxBufferIndex)) {
-        RxRingbuffer.getNextBuffer();
+      if (Queue.Fifo.push(rxBufferIndex)) {
+        Ring.getNextBuffer();
+        InputWait.notify();
       } else {
-        ITCounters.FifoPushErrors++;
+        Counters.FifoPushErrors++;
       }
     } else {
+      Counters.RxIdle +=
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              local_clock::now() - idle_start)
+              .count();
+    }
+  }
+}
+
+void Detector::receiveBatched(UDPReceiver &dataReceiver, InputQueue &Queue,
+                              InputCounters &Counters, bool Aggregate,
+                              int BatchSize) {
+  auto &Ring = Queue.Ring;
+  std::vector<char *> BatchBuffers(BatchSize);
+  std::vector<int> BatchLengths(BatchSize);
+  unsigned int RingEntries = Ring.getMaxElements();
+  Timer AggregateTimer(AggregateIntervalNS);
+
+  while (runThreads) {
+
+    if (Aggregate and AggregateTimer.timeout()) {
+      aggregateInputCounters();
+    }
+
+    auto idle_start = local_clock::now();
+
+    // Hand the next BatchSize ringbuffer entries to the receiver. Entries
+    // are only claimed (getNextBuffer) once pushed to the FIFO, so unused
+    // entries are simply reused by the next batch.
+    unsigned int FirstIndex = Ring.getDataIndex();
+    for (int i = 0; i < BatchSize; i++) {
+      unsigned int Index = (FirstIndex + i) % RingEntries;
+      Ring.setDataLength(Index, 0);
+      BatchBuffers[i] = Ring.getDataBuffer(Index);
+    }
+
+    int Received =
+        dataReceiver.receiveBatch(BatchBuffers.data(), Ring.getMaxBufSize(),
+                                  BatchLengths.data(), BatchSize);
+
+    if (Received <= 0) {
+      Counters.RxIdle +=
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              local_clock::now() - idle_start)
+              .count();
+      continue;
+    }
+
+    XTRACE(INPUT, DEB, "Received a batch of %d udp packets", Received);
+    Counters.RxBatches++;
+    Counters.RxBatchFill = Received;
+    if (Received == BatchSize) {
+      Counters.RxBatchFull++;
+    }
+
+    // Once a push fails the following entries cannot be pushed either,
+    // as entries must enter the FIFO in ringbuffer order
+    bool FifoFull{false};
+    bool Calibration = CalibrationMode;
+    for (int i = 0; i < Received; i++) {
+      char *DataPtr = BatchBuffers[i];
+      int readSize = BatchLengths[i];
+      Counters.RxPackets++;
+      Counters.RxBytes += readSize;
+
+      // Calibration mode send all raw input data to sample topic
+      if (Calibration) {
+        queueMonitorPacket(Queue, Counters, DataPtr, readSize);
+        continue;
+      } else if (Counters.RxPackets % EFUSettings.MonitorPeriod <
+                 EFUSettings.MonitorSamples) {
+        queueMonitorPacket(Queue, Counters, DataPtr, readSize);
+      }
+
+      if (FifoFull) {
+        Counters.FifoPushErrors++;
+        continue;
+      }
+
+      unsigned int rxBufferIndex = Ring.getDataIndex();
+      Ring.setDataLength(rxBufferIndex, readSize);
+      if (Queue.Fifo.push(rxBufferIndex)) {
+        Ring.getNextBuffer();
+      } else {
+        Counters.FifoPushErrors++;
+        FifoFull = true;
+      }
+    }
+    InputWait.notify();
+  }
+}
+
+void Detector::receivePacketMmap() {
+  PacketMmapReceiver dataReceiver(EFUSettings.RxInterface,
+                                  EFUSettings.DetectorAddress,
+                                  EFUSettings.DetectorPort);
+  int TimeoutMS = std::max(1, EFUSettings.SocketRxTimeoutUS / 1000);
+
+  LOG(INIT, Sev::Info, "Detector input thread started on {} ({}:{}), zero copy",
+      EFUSettings.RxInterface, EFUSettings.DetectorAddress,
+      EFUSettings.DetectorPort);
+
+  // Kernel ring statistics are reset on every read, accumulate them here
+  auto updateRingStats = [this, &dataReceiver]() {
+    uint64_t Packets, Drops;
+    dataReceiver.readStatistics(Packets, Drops);
+    ITCounters.RxPackets += Packets - Drops;
+    ITCounters.FifoPushErrors += Drops;
+  };
+
+  uint64_t Received{0}; // for monitor sampling, RxPackets lags behind
+  uint64_t Pushed{0};
+  while (runThreads) {
+
+    // The consumer may still be working on the entry it popped last, all
+    // entries before that are done and their blocks can be reused
+    uint64_t Popped = Pushed - InputFifo.size();
+    dataReceiver.releaseBlocks(Popped > 0 ? Popped - 1 : 0);
+
+    auto idle_start = local_clock::now();
+
+    char *DataPtr;
+    int readSize;
+    if (not dataReceiver.receive(DataPtr, readSize, TimeoutMS)) {
+      updateRingStats();
       ITCounters.RxIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
               .count();
+      continue;
+    }
+
+    XTRACE(INPUT, DEB, "Received an udp packet of length %d bytes", readSize);
+    Received++;
+    ITCounters.RxBytes += readSize;
+    if (Received % 1024 == 0) {
+      updateRingStats();
+    }
+
+    // Calibration mode send all raw input data to sample topic
+    if (CalibrationMode) {
+      queueMonitorPacket(*InputQueues[0], ITCounters, DataPtr, readSize);
+      continue;
+    } else if (Received % EFUSettings.MonitorPeriod <
+               EFUSettings.MonitorSamples) {
+      queueMonitorPacket(*InputQueues[0], ITCounters, DataPtr, readSize);
+    }
+
+    unsigned int rxBufferIndex = RxRingbuffer.getDataIndex();
+    RxRingbuffer.setExternalBuffer(rxBufferIndex, DataPtr, readSize);
+    if (InputFifo.push(rxBufferIndex)) {
+      Pushed++;
+      dataReceiver.holdCurrentBlock(Pushed);
+      RxRingbuffer.getNextBuffer();
+      InputWait.notify();
+    } else {
+      ITCounters.FifoPushErrors++;
     }
   }
-  XTRACE(INPUT, ALW, "Stopping input thread.");
-  return;
+}
+
+void Detector::queueMonitorPacket(InputQueue &Queue, InputCounters &Counters,
+                                  char *DataPtr, int DataLength) {
+  auto &Ring = Queue.MonitorRing;
+  unsigned int Index = Ring.getDataIndex();
+  std::memcpy(Ring.getDataBuffer(Index), DataPtr, DataLength);
+  Ring.setDataLength(Index, DataLength);
+  if (Queue.MonitorFifo.push(Index)) {
+    Ring.getNextBuffer();
+    MonitorWait.notify();
+  } else {
+    Counters.MonitorDrops++;
+  }
+}
+
+bool Detector::monitorAvailable() const {
+  for (auto &Queue : InputQueues) {
+    if (not Queue->MonitorFifo.wasEmpty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Detector::monitorThread() {
+  XTRACE(INPUT, DEB, "Starting monitorThread");
+  while (runThreads) {
+    int Produced{0};
+    for (size_t i = 0; i < InputQueues.size(); i++) {
+      auto &Queue = *InputQueues[i];
+      unsigned int Index;
+      for (int n = 0; n < MonitorBatchSize and Queue.MonitorFifo.pop(Index);
+           n++) {
+        auto &Ring = Queue.MonitorRing;
+        MonitorSerializer.addPacket((uint8_t *)Ring.getDataBuffer(Index),
+                                    Ring.getDataLength(Index));
+        inputCounters(i).TxRawReadoutPackets++;
+        Produced++;
+      }
+    }
+    MonitorSerializer.checkTimeout();
+
+    if (Produced == 0) {
+      MonitorWait.wait([this]() { return monitorAvailable(); });
+      MonitorProducer.poll(0);
+    }
+  }
+  MonitorSerializer.flush();
+  XTRACE(INPUT, ALW, "Stopping monitor thread.");
 }
 
 void Detector::startThreads() {
@@ -20,12 +20,17 @@
 #include <common/memory/RingBuffer.h>
 #include <common/memory/SPSCFifo.h>
 #include <common/readout/ess/Parser.h>
+#include <common/system/WaitStrategy.h>
 #include <cstdint>
+#include <memory>
 #include <thread>
+#include <vector>
 
 // #undef TRC_LEVEL
 // #define TRC_LEVEL TRC_L_DEB
 
+class UDPReceiver;
+
 struct ThreadInfo {
   std::function<void(void)> func;
   std::string name;
@@ -37,12 +42,23 @@ protected:
   BaseSettings EFUSettings;
   Statistics Stats;
 
-  struct ITCounters : public StatCounterBase {
+  /// \brief Counters updated by a single input thread
+  struct InputCounters {
     int64_t RxPackets{0};
     int64_t RxBytes{0};
     int64_t FifoPushErrors{0};
     int64_t RxIdle{0};
     int64_t TxRawReadoutPackets{0};
+    int64_t RxBatches{0};
+    int64_t RxBatchFill{0};
+    int64_t RxBatchFull{0};
+    int64_t MonitorDrops{0};
+  } __attribute__((aligned(64)));
+
+  /// \brief Registered input counters. With several input threads each
+  /// thread counts into its own InputCounters, and these are aggregated
+  /// here by the first input thread
+  struct ITCounters : public InputCounters, public StatCounterBase {
     int64_t FifoSeqErrors{0};
 
     ITCounters(Statistics &Stats)
@@ -53,7 +69,13 @@ protected:
                            {Detector::METRIC_FIFO_SEQ_ERRORS, FifoSeqErrors},
                            {Detector::METRIC_THREAD_INPUT_IDLE, RxIdle},
                            {Detector::METRIC_PRODUCE_MONITOR_PACKETS,
-                            TxRawReadoutPackets}}) {}
+                            TxRawReadoutPackets},
+                           {Detector::METRIC_RECEIVE_BATCHES, RxBatches},
+                           {Detector::METRIC_RECEIVE_BATCH_FILL, RxBatchFill},
+                           {Detector::METRIC_RECEIVE_BATCH_FULL,
+                            RxBatchFull},
+                           {Detector::METRIC_PRODUCE_MONITOR_DROPPED,
+                            MonitorDrops}}) {}
   } ITCounters;
 
 public:
@@ -65,6 +87,11 @@ public:
   static const std::string METRIC_THREAD_INPUT_IDLE;
   static const std::string METRIC_PRODUCE_MONITOR_PACKETS;
   static const std::string METRIC_FIFO_SEQ_ERRORS;
+  static const std::string METRIC_RECEIVE_BATCHES;
+  static const std::string METRIC_RECEIVE_BATCH_FILL;
+  static const std::string METRIC_RECEIVE_BATCH_FULL;
+  static const std::string METRIC_PRODUCE_MONITOR_DROPPED;
+  static const std::string METRIC_PRODUCE_MONITOR_MESSAGES;
 
   using CommandFunction =
       std::function<int(std::vector<std::string>, char *, unsigned int *)>;
@@ -91,7 +118,10 @@ public:
   Detector(BaseSettings settings)
       : EFUSettings(settings),
         Stats(settings.GraphitePrefix, settings.GraphiteRegion),
-        ITCounters(Stats), ESSHeaderParser(Stats),
+        ITCounters(Stats), InputQueues(createInputQueues(EFUSettings)),
+        InputWait(WaitStrategy::modeFromString(EFUSettings.ProcessingWait),
+                  EFUSettings.ProcessingWaitTimeoutUS),
+        ESSHeaderParser(Stats),
         KafkaCfg(EFUSettings.KafkaConfigFile),
         MonitorProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaDebugTopic,
                         KafkaCfg.CfgParms, Stats, "monitor"),
@@ -101,10 +131,14 @@ public:
               MonitorProducer.produce(DataBuffer, Timestamp);
             }) {
     // ITCounters are now registered automatically via StatCounterBase
+    Stats.create(METRIC_PRODUCE_MONITOR_MESSAGES, MonitorSerializer.SeqNum);
+    MonitorSerializer.setBatching(EFUSettings.MonitorBatchBytes,
+                                  EFUSettings.MonitorBatchMS * 1'000'000ULL);
   }
 
   /// Receiving UDP data is now common across all detectors
-  void inputThread();
+  /// \param QueueIndex input queue filled by this thread
+  void inputThread(size_t QueueIndex = 0);
 
   virtual ~Detector() = default;
 
@@ -170,14 +204,90 @@ public:
   static constexpr int EthernetBufferMaxEntries{2000};
   static constexpr int EthernetBufferSize{9000}; /// bytes
   static constexpr int KafkaBufferSize{12'400};  /// entries ~ 100kB
+  static constexpr int RxBatchMaxEntries{64}; /// max packets per recvmmsg()
+  static constexpr int MonitorBufferMaxEntries{256}; /// sampled packets
+
+  using InputFifoType =
+      memory_relaxed_acquire_release::CircularFifo<unsigned int,
+                                                   EthernetBufferMaxEntries>;
+  using RxRingbufferType = RingBuffer<EthernetBufferSize>;
+  using MonitorFifoType =
+      memory_relaxed_acquire_release::CircularFifo<unsigned int,
+                                                   MonitorBufferMaxEntries>;
+
+  /// \brief FIFO and ringbuffer filled by one input thread
+  struct InputQueue {
+    InputFifoType Fifo;
+    /// \todo the number 11 is a workaround
+    /// A batched receive writes up to RxBatchMaxEntries buffers ahead of the
+    /// current index, so these must not overlap buffers still in the FIFO
+    RxRingbufferType Ring{EthernetBufferMaxEntries + 11 + RxBatchMaxEntries};
+    /// Copies of sampled packets for the monitor thread. Two extra entries
+    /// for the one being written and the one being serialized
+    MonitorFifoType MonitorFifo;
+    RxRingbufferType MonitorRing{MonitorBufferMaxEntries + 2};
+    InputCounters Counters;
+  };
+
+  /// One queue per input thread, see BaseSettings::RxThreads
+  std::vector<std::unique_ptr<InputQueue>> InputQueues;
+
+  /// Shared between input_thread and processing_thread (first input queue)
+  InputFifoType &InputFifo{InputQueues[0]->Fifo};
+  RxRingbufferType &RxRingbuffer{InputQueues[0]->Ring};
+
+  /// \brief Pop the next entry from the input queues. Queues are visited
+  /// round robin so that a busy input thread cannot starve the others.
+  /// Only to be called from the processing thread.
+  /// \param DataIndex set to the ringbuffer index of the entry
+  /// \return ringbuffer holding the entry, nullptr if all queues are empty
+  inline RxRingbufferType *popInput(unsigned int &DataIndex) {
+    for (size_t i = 0; i < InputQueues.size(); i++) {
+      auto &Queue = *InputQueues[NextInputQueue];
+      if (++NextInputQueue == InputQueues.size()) {
+        NextInputQueue = 0;
+      }
+      if (Queue.Fifo.pop(DataIndex)) {
+        return &Queue.Ring;
+      }
+    }
+    return nullptr;
+  }
+
+  /// \brief true if any input queue has data
+  inline bool inputAvailable() const {
+    for (auto &Queue : InputQueues) {
+      if (not Queue->Fifo.wasEmpty()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// \brief Called by processing threads when there is no input data.
+  /// Returns when data arrives or the configured wait has expired
+  /// (see BaseSettings::ProcessingWait)
+  inline void waitForInput() {
+    InputWait.wait([this]() { return inputAvailable(); });
+  }
 
-  /// Shared between input_thread and processing_thread
-  memory_sequential_consistent::CircularFifo<unsigned int,
-                                             EthernetBufferMaxEntries>
-      InputFifo;
+  /// Processing thread idle wait, signalled by the input threads
+  WaitStrategy InputWait;
 
-  /// \todo the number 11 is a workaround
-  RingBuffer<EthernetBufferSize> RxRingbuffer{EthernetBufferMaxEntries + 11};
+  /// \brief Move the memory of an input queue (FIFOs and ringbuffers) to a
+  /// NUMA node, used when the input thread is pinned to a core
+  /// \return true on success
+  bool placeInputQueue(size_t QueueIndex, int Node);
+
+  /// \brief Register one input thread per input queue
+  /// ("input", "input_1", ...) and the monitor thread with the thread list
+  void addInputThreads();
+
+  /// \brief Serializes and produces the raw packets sampled by the input
+  /// threads on the monitor (ar51) topic, so that this does not delay
+  /// reception. With BaseSettings::MonitorBatchBytes several packets are
+  /// packed per message, see AR51Serializer
+  void monitorThread();
 
   // Ideally should match the CPU speed, but as this varies across
   // CPU versions we just select something in the 'middle'. This is
@@ -199,6 +309,55 @@ protected:
   KafkaConfig KafkaCfg;
 
 private:
+  /// \brief create the input queues, one per input thread
+  static std::vector<std::unique_ptr<InputQueue>>
+  createInputQueues(const BaseSettings &Settings);
+
+  /// \brief input loop receiving one packet per system call
+  void receiveSingle(UDPReceiver &Receiver, InputQueue &Queue,
+                     InputCounters &Counters, bool Aggregate);
+
+  /// \brief input loop receiving up to BatchSize packets per system call
+  /// into consecutive ring buffer entries
+  void receiveBatched(UDPReceiver &Receiver, InputQueue &Queue,
+                      InputCounters &Counters, bool Aggregate, int BatchSize);
+
+  /// \brief sum the per thread input counters into ITCounters
+  void aggregateInputCounters();
+
+  /// \brief input loop for the zero copy AF_PACKET (TPACKET_V3) backend.
+  /// Ringbuffer entries point into the kernel ring, and packet/drop counts
+  /// are taken from the kernel ring statistics
+  void receivePacketMmap();
+
+  /// \brief counters used by the input thread of a queue
+  InputCounters &inputCounters(size_t QueueIndex);
+
+  /// \brief copy a sampled packet to the monitor queue, counted as
+  /// MonitorDrops if the monitor thread is behind
+  void queueMonitorPacket(InputQueue &Queue, InputCounters &Counters,
+                          char *DataPtr, int DataLength);
+
+  size_t NextInputQueue{0}; ///< used by popInput()
+
+  /// How often per thread input counters are aggregated into ITCounters
+  static constexpr uint64_t AggregateIntervalNS{100'000'000};
+
+  /// Max sampled packets produced from one queue before moving on
+  static constexpr int MonitorBatchSize{32};
+
+  /// Max time the idle monitor thread blocks before polling Kafka and
+  /// checking the batch timeout
+  static constexpr uint32_t MonitorWaitTimeoutUS{10'000};
+
+  /// Monitor thread idle wait, signalled by queueMonitorPacket(). Always
+  /// adaptive so an idle monitor thread does not keep a core busy
+  WaitStrategy MonitorWait{WaitStrategy::Mode::Adaptive, MonitorWaitTimeoutUS};
+
+  /// \brief true if any monitor queue has sampled packets
+  bool monitorAvailable() const;
+
+  /// Only used by the monitor thread
   Producer MonitorProducer;
   AR51Serializer MonitorSerializer;
 };
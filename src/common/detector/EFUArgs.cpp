@@ -32,7 +32,8 @@ EFUArgs::EFUArgs() {
   CLIParser.add_option("-a,--logip", GraylogConfig.address, "Graylog server IP address")
       ->group("Logging Options")->default_str("127.0.0.1");
 
-  CLIParser.add_option("-b,--broker_addr", EFUSettings.KafkaBroker, "Kafka broker address")
+  CLIParser.add_option("-b,--broker_addr", EFUSettings.KafkaBroker,
+                  "Kafka broker address, or null:// to discard messages, or file:///dir to write them to dir/<topic>.bin")
       ->group("Kafka Options")->default_str("localhost");
 
   CLIParser.add_option("-t,--broker_topic", EFUSettings.KafkaTopic, "Kafka broker topic")
@@ -41,9 +42,21 @@ EFUArgs::EFUArgs() {
   CLIParser.add_option("--ar51_topic", EFUSettings.KafkaDebugTopic, "Kafka debug (ar51) topic")
       ->group("Kafka Options")->default_str("");
 
+  CLIParser.add_option("--ar51_batch_bytes", EFUSettings.MonitorBatchBytes,
+                  "Pack raw packets into ar51 messages of up to N bytes, source_name gets a _batch suffix. 0 sends one packet per message")
+      ->group("Kafka Options")->default_str("0");
+
+  CLIParser.add_option("--ar51_batch_ms", EFUSettings.MonitorBatchMS,
+                  "Max time a raw packet waits in an ar51 batch")
+      ->group("Kafka Options")->default_str("100");
+
   CLIParser.add_option("--kafka_config", EFUSettings.KafkaConfigFile, "Kafka configuration file")
       ->group("Kafka Options")->default_str("");
 
+  CLIParser.add_flag("--kafka_thread", EFUSettings.KafkaThread,
+                  "Produce and poll the event producer in its own thread")
+      ->group("Kafka Options");
+
   CLIParser.add_option("-l,--log_level", [this](const std::vector<std::string> &Input) {
     return parseLogLevel(Input);
   }, "Set log message level. Set to 1 - 7 or one of \n                              `Critical`, `Error`, `Warning`, `Notice`, `Info`,\n                              or `Debug`. Ex: \"-l Notice\"")
@@ -58,6 +71,11 @@ EFUArgs::EFUArgs() {
   CLIParser.add_option("--checkif", EFUSettings.Interfaces, "Perform MTU check on these interfaces")
       ->group("EFU Options");
 
+  CLIParser.add_option("--affinity", EFUSettings.ThreadAffinity,
+                  "Pin threads to cores, thread:core (e.g. input:2 processing:4).\n"
+                  "                              Overrides ThreadAffinity in the config file")
+      ->group("EFU Options");
+
   std::string DetectorDescription{"Detector name"};
 
   CLIParser.add_option("-i,--dip", EFUSettings.DetectorAddress,
@@ -102,6 +120,40 @@ EFUArgs::EFUArgs() {
                   "Transmit to detector buffer size.")
       ->group("TCPIP Options")->default_str("9216");
 
+  CLIParser.add_option("--rx_batch", EFUSettings.RxBatchSize,
+                  "Max packets per receive system call (recvmmsg), 1 disables batching")
+      ->group("TCPIP Options")->default_str("1")
+      ->check(CLI::PositiveNumber);
+
+  CLIParser.add_option("--rx_threads", EFUSettings.RxThreads,
+                  "Number of input threads, each with its own SO_REUSEPORT socket")
+      ->group("TCPIP Options")->default_str("1")
+      ->check(CLI::Range(1, 16));
+
+  CLIParser.add_option("--rx_backend", EFUSettings.RxBackend,
+                  "Receive backend: udp (socket) or packet_mmap (zero copy AF_PACKET ring)")
+      ->group("TCPIP Options")->default_str("udp")
+      ->check(CLI::IsMember({"udp", "packet_mmap"}));
+
+  CLIParser.add_option("--rx_interface", EFUSettings.RxInterface,
+                  "Network interface to receive on (packet_mmap backend)")
+      ->group("TCPIP Options")->default_str("");
+
+  CLIParser.add_option("--processing_wait", EFUSettings.ProcessingWait,
+                  "Processing thread idle wait: sleep (fixed 100us), spin, or adaptive (spin, yield, then block until data)")
+      ->group("TCPIP Options")->default_str("adaptive")
+      ->check(CLI::IsMember({"sleep", "spin", "adaptive"}));
+
+  CLIParser.add_option("--processing_wait_timeout", EFUSettings.ProcessingWaitTimeoutUS,
+                  "Max time (us) a processing thread blocks in adaptive wait")
+      ->group("TCPIP Options")->default_str("1000")
+      ->check(CLI::PositiveNumber);
+
+  CLIParser.add_option("--processing_workers", EFUSettings.ProcessingWorkers,
+                  "Number of worker threads packets are distributed to by OutputQueue, 1 processes in the processing thread (CAEN only)")
+      ->group("TCPIP Options")->default_str("1")
+      ->check(CLI::Range(1, 16));
+
   //
   CLIParser.add_option("-f,--file", EFUSettings.ConfigFile,
                   "Detector configuration file (JSON)")
@@ -25,8 +25,9 @@
 #include <common/StatCounterBase.h>
 #include <common/Statistics.h>
 #include <common/debug/Trace.h>
-#include <common/memory/HashMap2D.h>
+#include <common/memory/DenseMap2D.h>
 #include <string>
+#include <type_traits>
 
 namespace geometry {
 
@@ -139,7 +140,7 @@ protected:
   }
 
   template <typename U>
-  inline bool validateTopology(HashMap2D<U> &map, int Col, int Row) const {
+  inline bool validateTopology(DenseMap2D<U> &map, int Col, int Row) const {
     if (not map.isValue(Col, Row)) {
       XTRACE(DATA, WAR, "Col %d, Row %d is incompatible with config", Col, Row);
       BaseCounters.TopologyError++;
@@ -193,6 +194,29 @@ public:
 
     return pixel;
   }
+
+  /// \brief Pixel calculation with automatic error counting, without virtual
+  /// dispatch. For processing loops that know the concrete geometry, so that
+  /// the compiler can call (or inline) its calcPixelImpl() directly
+  /// \tparam GeometryType The type of this object, must be final and a
+  /// friend of DetectorGeometry
+  /// \param Data Data object of type TData to calculate pixel for
+  /// \return Same as calcPixel()
+  template <typename GeometryType>
+  inline uint32_t calcPixelStatic(const TData &Data) const {
+    static_assert(std::is_base_of_v<DetectorGeometry, GeometryType>,
+                  "GeometryType must derive from DetectorGeometry");
+    static_assert(std::is_final_v<GeometryType>,
+                  "GeometryType must be final");
+    const auto &Geom = static_cast<const GeometryType &>(*this);
+    uint32_t pixel = Geom.GeometryType::calcPixelImpl(Data);
+    if (pixel == 0) {
+      BaseCounters.PixelErrors++;
+      XTRACE(DATA, DEB, "Pixel calculation failed, counted as pixel error");
+    }
+
+    return pixel;
+  }
 };
 
 } // namespace geometry
\ No newline at end of file
@@ -1,4 +1,4 @@
-// Copyright (C) 2023 European Spallation Source, ERIC. see LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -10,6 +10,7 @@
 
 #include <common/debug/Trace.h>
 #include <common/kafka/AR51Serializer.h>
+#include <cstring>
 
 // #undef TRC_LEVEL
 // #define TRC_LEVEL TRC_L_DEB
@@ -21,17 +22,24 @@ static_assert(FLATBUFFERS_LITTLEENDIAN,
 
 AR51Serializer::AR51Serializer(
     const std::string &SourceName, ProducerCallback Callback) :
-    Source(SourceName), ProduceFunctor(Callback) {
+    Source(SourceName), ProduceFunctor(Callback),
+    BatchSource(SourceName + BatchSuffix) {
 }
 
 
 nonstd::span<const uint8_t> & AR51Serializer::serialize(uint8_t *Data, int DataLength) {
+  return serialize(Data, DataLength, Source);
+}
+
+nonstd::span<const uint8_t> &
+AR51Serializer::serialize(uint8_t *Data, int DataLength,
+                          const std::string &SourceName) {
   FBBuilder.Reset();
   auto DataBuffer = FBBuilder.CreateVector(Data, DataLength);
 
   auto HeaderOffset = CreateRawReadoutMessage(
     FBBuilder,
-    FBBuilder.CreateString(Source),
+    FBBuilder.CreateString(SourceName),
     SeqNum++,
     DataBuffer);
 
@@ -54,3 +62,56 @@ size_t AR51Serializer::produce() {
   }
   return 0;
 }
+
+void AR51Serializer::setBatching(size_t MaxBytes, uint64_t MaxDelayNS) {
+  flush();
+  BatchMaxBytes = MaxBytes;
+  BatchMaxDelayNS = MaxDelayNS;
+  Batch.clear();
+  Batch.reserve(MaxBytes);
+}
+
+size_t AR51Serializer::addPacket(uint8_t *Data, int DataLength) {
+  if (BatchMaxBytes == 0) {
+    serialize(Data, DataLength);
+    return produce();
+  }
+
+  size_t Sent{0};
+  size_t Needed = sizeof(uint32_t) + DataLength;
+  if (not Batch.empty() and Batch.size() + Needed > BatchMaxBytes) {
+    Sent += flush();
+  }
+  if (Batch.empty()) {
+    BatchTimer.reset();
+  }
+
+  uint32_t Length = DataLength;
+  size_t Offset = Batch.size();
+  Batch.resize(Offset + Needed);
+  std::memcpy(&Batch[Offset], &Length, sizeof(Length));
+  std::memcpy(&Batch[Offset + sizeof(Length)], Data, DataLength);
+  XTRACE(OUTPUT, DEB, "batched %d bytes, batch size %zu", DataLength,
+         Batch.size());
+
+  if (Batch.size() >= BatchMaxBytes) {
+    Sent += flush();
+  }
+  return Sent;
+}
+
+size_t AR51Serializer::checkTimeout() {
+  if (Batch.empty() or BatchTimer.timeNS() < BatchMaxDelayNS) {
+    return 0;
+  }
+  return flush();
+}
+
+size_t AR51Serializer::flush() {
+  if (Batch.empty()) {
+    return 0;
+  }
+  serialize(Batch.data(), Batch.size(), BatchSource);
+  Batch.clear();
+  return produce();
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, ERIC. see LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -6,16 +6,31 @@
 /// \brief flatbuffer serialization into ar52 schema
 ///
 /// See https://github.com/ess-dmsc/streaming-data-types
+///
+/// By default every raw packet is sent in its own message, raw_data holding
+/// the packet as received. With batching enabled (setBatching()) several
+/// packets are packed into one message, each preceded by its length as a
+/// 32 bit little endian integer:
+///
+///   raw_data = | len 0 | packet 0 | len 1 | packet 1 | ...
+///
+/// Batched messages are marked by appending BatchSuffix to source_name,
+/// so consumers can tell the two formats apart on the same topic.
 //===----------------------------------------------------------------------===//
 
 #pragma once
 
 #include <common/kafka/Producer.h>
+#include <common/time/Timer.h>
 #include <ar51_readout_data_generated.h>
+#include <vector>
 
 
 class AR51Serializer {
 public:
+  /// \brief source_name suffix of messages holding length prefixed packets
+  static constexpr const char *BatchSuffix{"_batch"};
+
   /// \brief creates ar51 flat buffer serializer
   /// \param source_name value for source_name field
   /// \param Callback
@@ -32,6 +47,28 @@ public:
   /// \returns bytes transmitted
   size_t produce();
 
+  /// \brief pack several raw packets into each message
+  /// \param MaxBytes raw_data bytes per message, a batch is produced when
+  ///        the next packet would exceed this. 0 disables batching
+  /// \param MaxDelayNS maximum time the first packet of a batch waits
+  ///        before the batch is produced, see checkTimeout()
+  void setBatching(size_t MaxBytes, uint64_t MaxDelayNS);
+
+  /// \brief serialize and produce a raw packet, or with batching append it
+  /// to the current batch, producing the batch when the byte budget is
+  /// reached
+  /// \returns bytes transmitted, if any
+  size_t addPacket(uint8_t *Data, int DataLength);
+
+  /// \brief produce the current batch if its first packet has waited
+  /// longer than the time budget
+  /// \returns bytes transmitted, if any
+  size_t checkTimeout();
+
+  /// \brief produce the current batch, if any
+  /// \returns bytes transmitted, if any
+  size_t flush();
+
   // \todo make private?
   /// \brief serializes buffer
   /// \returns reference to internally stored buffer
@@ -46,4 +83,15 @@ public:
   ProducerCallback ProduceFunctor;
   int64_t SeqNum{0};
   int64_t TxBytes{0};
+
+private:
+  /// \brief serializes buffer with the given source_name
+  nonstd::span<const uint8_t> &serialize(uint8_t *Data, int DataLength,
+                                         const std::string &SourceName);
+
+  std::string BatchSource;   ///< Source with BatchSuffix appended
+  size_t BatchMaxBytes{0};   ///< 0 sends one packet per message
+  uint64_t BatchMaxDelayNS{0};
+  std::vector<uint8_t> Batch; ///< length prefixed packets not yet produced
+  Timer BatchTimer;          ///< started by the first packet of a batch
 };
@@ -9,12 +9,15 @@
 //===----------------------------------------------------------------------===//
 
 #include <ev44_events_generated.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <common/kafka/EV44Serializer.h>
 #include <common/system/gccintel.h>
 
 #include <common/debug/Trace.h>
 #include <cstdint>
+#include <memory>
 
 // #undef TRC_LEVEL
 // #define TRC_LEVEL TRC_L_DEB
@@ -36,39 +39,118 @@ static constexpr int64_t FBMutablePlaceholder = 1;
 static_assert(FLATBUFFERS_LITTLEENDIAN,
               "Flatbuffers only tested on little endian systems");
 
-EV44Serializer::EV44Serializer(size_t MaxArrayLength, const std::string &SourceName,
-                               ProducerCallback Callback)
-    : MaxEvents(MaxArrayLength), Builder_(MaxEvents * 8 + 256),
-      ProduceFunctor(Callback), Stats() {
+/// \brief one preformatted ev44 flatbuffer and the accessors into it
+struct EV44Serializer::MessageBuffer : public ProducerBufferRelease {
+  MessageBuffer(size_t MaxEvents, const std::string &SourceName,
+                BufferPool &Pool);
+
+  /// \brief called by the producer when the buffer can be reused
+  void release() override;
+
+  flatbuffers::FlatBufferBuilder Builder;
+
+  uint8_t *ReferenceTimePtr{nullptr};
+  uint8_t *OffsetTimePtr{nullptr};
+  uint8_t *PixelPtr{nullptr};
+
+  Event44Message *Message{nullptr};
+  nonstd::span<const uint8_t> Span;
+  flatbuffers::uoffset_t *TimeLengthPtr{nullptr};
+  flatbuffers::uoffset_t *PixelLengthPtr{nullptr};
+
+  /// queued in the producer, set by the serializer and cleared by release()
+  std::atomic<bool> InFlight{false};
+  BufferPool &Pool;
+};
 
-  auto SourceNameOffset = Builder_.CreateString(SourceName);
-  auto ReferenceTimeOffset = Builder_.CreateUninitializedVector(
+/// \brief the buffers of a serializer, referenced by the serializer and by
+/// each buffer in flight
+struct EV44Serializer::BufferPool {
+  std::vector<std::unique_ptr<MessageBuffer>> Buffers;
+  std::atomic<size_t> References{1};
+
+  void unref() {
+    if (References.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+};
+
+EV44Serializer::MessageBuffer::MessageBuffer(size_t MaxEvents,
+                                             const std::string &SourceName,
+                                             BufferPool &Pool)
+    : Builder(MaxEvents * 8 + 256), Pool(Pool) {
+  auto SourceNameOffset = Builder.CreateString(SourceName);
+  auto ReferenceTimeOffset = Builder.CreateUninitializedVector(
       1, ReferenceTimeSize, &ReferenceTimePtr);
   auto ReferenceTimeIndexOffset =
-      Builder_.CreateVector<int32_t>(std::vector(1, 0));
-  auto OffsetTimeOffset = Builder_.CreateUninitializedVector(
+      Builder.CreateVector<int32_t>(std::vector(1, 0));
+  auto OffsetTimeOffset = Builder.CreateUninitializedVector(
       MaxEvents, OffsetTimeSize, &OffsetTimePtr);
   auto PixelOffset =
-      Builder_.CreateUninitializedVector(MaxEvents, PixelSize, &PixelPtr);
+      Builder.CreateUninitializedVector(MaxEvents, PixelSize, &PixelPtr);
 
   auto HeaderOffset = CreateEvent44Message(
-      Builder_, SourceNameOffset, FBMutablePlaceholder, ReferenceTimeOffset,
+      Builder, SourceNameOffset, FBMutablePlaceholder, ReferenceTimeOffset,
       ReferenceTimeIndexOffset, OffsetTimeOffset, PixelOffset);
-  FinishEvent44MessageBuffer(Builder_, HeaderOffset);
+  FinishEvent44MessageBuffer(Builder, HeaderOffset);
+
+  Span = nonstd::span<const uint8_t>(Builder.GetBufferPointer(),
+                                     Builder.GetSize());
+
+  Message = const_cast<Event44Message *>(
+      GetEvent44Message(Builder.GetBufferPointer()));
+  TimeLengthPtr = reinterpret_cast<flatbuffers::uoffset_t *>(
+                      const_cast<uint8_t *>(Message->time_of_flight()->Data())) -
+                  1;
+  PixelLengthPtr = reinterpret_cast<flatbuffers::uoffset_t *>(
+                       const_cast<uint8_t *>(Message->pixel_id()->Data())) -
+                   1;
+
+  Message->mutate_message_id(0);
+}
 
-  Buffer_ = nonstd::span<const uint8_t>(Builder_.GetBufferPointer(),
-                                        Builder_.GetSize());
+void EV44Serializer::MessageBuffer::release() {
+  InFlight.store(false, std::memory_order_release);
+  Pool.unref();
+}
+
+EV44Serializer::EV44Serializer(size_t MaxArrayLength, const std::string &SourceName,
+                               ProducerCallback Callback)
+    : MaxEvents(MaxArrayLength), Pool(new BufferPool),
+      ProduceFunctor(Callback), Stats() {
+  Pool->Buffers.push_back(
+      std::make_unique<MessageBuffer>(MaxEvents, SourceName, *Pool));
+  useBuffer(0);
+}
+
+EV44Serializer::EV44Serializer(size_t MaxArrayLength,
+                               const std::string &SourceName,
+                               ProducerBase &Producer, size_t Buffers)
+    : MaxEvents(MaxArrayLength), Pool(new BufferPool),
+      ZeroCopyProducer(&Producer), Stats() {
+  for (size_t i = 0; i < std::max<size_t>(Buffers, 1); i++) {
+    Pool->Buffers.push_back(
+        std::make_unique<MessageBuffer>(MaxEvents, SourceName, *Pool));
+  }
+  useBuffer(0);
+}
 
-  Event44Message_ = const_cast<Event44Message *>(
-      GetEvent44Message(Builder_.GetBufferPointer()));
-  TimeLengthPtr =
-      reinterpret_cast<flatbuffers::uoffset_t *>(const_cast<uint8_t *>(
-          Event44Message_->time_of_flight()->Data())) - 1;
-  PixelLengthPtr =
-      reinterpret_cast<flatbuffers::uoffset_t *>(
-          const_cast<uint8_t *>(Event44Message_->pixel_id()->Data())) - 1;
+EV44Serializer::~EV44Serializer() { Pool->unref(); }
 
-  Event44Message_->mutate_message_id(0);
+void EV44Serializer::useBuffer(size_t Index) {
+  MessageBuffer &Next = *Pool->Buffers[Index];
+  if (ReferenceTimePtr != nullptr) {
+    reinterpret_cast<int64_t *>(Next.ReferenceTimePtr)[0] = referenceTime();
+  }
+  Current = Index;
+  ReferenceTimePtr = Next.ReferenceTimePtr;
+  OffsetTimePtr = Next.OffsetTimePtr;
+  PixelPtr = Next.PixelPtr;
+  Event44Message_ = Next.Message;
+  Buffer_ = Next.Span;
+  TimeLengthPtr = Next.TimeLengthPtr;
+  PixelLengthPtr = Next.PixelLengthPtr;
 }
 
 void EV44Serializer::setProducerCallback(ProducerCallback Callback) {
@@ -97,20 +179,46 @@ size_t EV44Serializer::produce() {
   if (EventCount != 0) {
     XTRACE(OUTPUT, DEB, "autoproduce %zu EventCount_ \n", EventCount);
     serialize();
-    if (ProduceFunctor) {
+    size_t Bytes = Buffer_.size_bytes();
 
-      // produce kafka message timestamp with current timestamp from hardware
-      // clock
-      uint64_t currentHwClock =
-          duration_cast<milliseconds>(system_clock::now().time_since_epoch())
-              .count();
+    // produce kafka message timestamp with current timestamp from hardware
+    // clock
+    uint64_t currentHwClock =
+        duration_cast<milliseconds>(system_clock::now().time_since_epoch())
+            .count();
+    if (ZeroCopyProducer) {
+      produceZeroCopy(currentHwClock);
+    } else if (ProduceFunctor) {
       ProduceFunctor(Buffer_, currentHwClock);
     }
-    return Buffer_.size_bytes();
+    return Bytes;
   }
   return 0;
 }
 
+void EV44Serializer::produceZeroCopy(int64_t MessageTimestampMS) {
+  size_t Buffers = Pool->Buffers.size();
+  for (size_t i = 1; i < Buffers; i++) {
+    size_t Next = (Current + i) % Buffers;
+    if (Pool->Buffers[Next]->InFlight.load(std::memory_order_acquire)) {
+      continue;
+    }
+
+    // the producer may release the buffer before returning
+    MessageBuffer &Sent = *Pool->Buffers[Current];
+    Sent.InFlight.store(true, std::memory_order_relaxed);
+    Pool->References.fetch_add(1, std::memory_order_relaxed);
+    useBuffer(Next);
+    Stats.ProduceZeroCopy++;
+    ZeroCopyProducer->produceZeroCopy(Sent.Span, MessageTimestampMS, Sent);
+    return;
+  }
+
+  XTRACE(OUTPUT, DEB, "all %zu buffers in flight, copying message", Buffers);
+  Stats.ProduceCopied++;
+  ZeroCopyProducer->produce(Buffer_, MessageTimestampMS);
+}
+
 size_t EV44Serializer::eventCount() const { return EventCount; }
 
 uint32_t EV44Serializer::checkAndSetReferenceTime(int64_t Time) {
@@ -8,6 +8,11 @@
 /// builder's buffers in place. This should increase the performance and mem
 /// copy.
 ///
+/// When constructed with a ProducerBase, the serializer keeps several
+/// preformatted buffers. A produced buffer is handed to the producer without
+/// copying and events are added to the next free buffer meanwhile. Only when
+/// all buffers are still queued in the producer is the message copied.
+///
 /// See https://github.com/ess-dmsc/streaming-data-types
 //===----------------------------------------------------------------------===//
 
@@ -26,6 +31,8 @@ struct EV44SerializerStats : public fbserializer::SerializerStats {
                                            ///< function has been called due to
                                            ///< the maximum number of events
                                            ///< being reached.
+  int64_t ProduceZeroCopy{0}; ///< messages handed to the producer in place
+  int64_t ProduceCopied{0};   ///< messages copied as no buffer was free
 };
 
 class EV44Serializer {
@@ -36,7 +43,14 @@ public:
   EV44Serializer(size_t MaxArrayLength, const std::string &SourceName,
                  ProducerCallback Callback = {});
 
-  virtual ~EV44Serializer() = default;
+  /// \brief creates ev44 flat buffer serializer sending without copying
+  /// \param Producer used for sending, must outlive the serializer
+  /// \param Buffers number of buffers, events are added to one while the
+  /// others are queued in the producer
+  EV44Serializer(size_t MaxArrayLength, const std::string &SourceName,
+                 ProducerBase &Producer, size_t Buffers = 2);
+
+  virtual ~EV44Serializer();
 
   /// \brief Explicitly disallow copy constructor
   EV44Serializer(const EV44Serializer &other) = delete;
@@ -90,19 +104,34 @@ public:
   int64_t ProduceCauseMaxEventsReached;
 
 private:
+  struct MessageBuffer;
+  struct BufferPool;
+
+  /// \brief points the accessors below at buffer Index, keeping the
+  /// reference time
+  void useBuffer(size_t Index);
+
+  /// \brief sends the current buffer in place if another one is free to
+  /// take the following events, else copies it
+  void produceZeroCopy(int64_t MessageTimestampMS);
+
   /// \todo should this not be predefined in terms of jumbo frame?
   size_t MaxEvents{0};
   size_t EventCount{0};
 
   uint64_t MessageId{1};
 
-  // All of this is the flatbuffer
-  flatbuffers::FlatBufferBuilder Builder_;
+  // The flatbuffers, shared with the messages queued in the producer so
+  // it is only deleted once all of them are released
+  BufferPool *Pool{nullptr};
+  size_t Current{0};
 
   ProducerCallback ProduceFunctor;
+  ProducerBase *ZeroCopyProducer{nullptr};
 
   EV44SerializerStats Stats;
 
+  // Accessors of the current buffer
   uint8_t *ReferenceTimePtr{nullptr};
   uint8_t *OffsetTimePtr{nullptr};
   uint8_t *PixelPtr{nullptr};
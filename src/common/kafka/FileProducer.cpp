@@ -0,0 +1,164 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Implementation of the memory mapped file producer
+///
+//===----------------------------------------------------------------------===//
+
+#include <common/debug/Log.h>
+#include <common/debug/Trace.h>
+#include <common/kafka/FileProducer.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// #undef TRC_LEVEL
+// #define TRC_LEVEL TRC_L_DEB
+
+namespace {
+constexpr size_t RecordAlignment{8};
+constexpr size_t SizePrefix{sizeof(uint64_t)};
+
+size_t roundUp(size_t Value, size_t Multiple) {
+  return (Value + Multiple - 1) / Multiple * Multiple;
+}
+} // namespace
+
+FileProducer::FileProducer(const std::string &Path, size_t ChunkSize)
+    : Path(Path) {
+  long Page = sysconf(_SC_PAGESIZE);
+  if (Page > 0) {
+    PageSize = Page;
+  }
+  this->ChunkSize = roundUp(std::max<size_t>(ChunkSize, 1), PageSize);
+
+  FileDescriptor = open(Path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (FileDescriptor < 0) {
+    LOG(KAFKA, Sev::Error, "Unable to open producer file {}: {}", Path,
+        strerror(errno));
+    throw std::runtime_error("system error - open() of producer file failed");
+  }
+  LOG(KAFKA, Sev::Info, "Producing to file {}", Path);
+}
+
+FileProducer::~FileProducer() {
+  unmap();
+  if (FileDescriptor >= 0) {
+    // drop the unused part of the last chunk
+    if (ftruncate(FileDescriptor, Offset) != 0) {
+      LOG(KAFKA, Sev::Warning, "Unable to truncate producer file {}: {}",
+          Path, strerror(errno));
+    }
+    close(FileDescriptor);
+  }
+}
+
+void FileProducer::unmap() {
+  if (Map != nullptr) {
+    munmap(Map, MapSize);
+    Map = nullptr;
+  }
+}
+
+bool FileProducer::reserve(size_t Bytes) {
+  if (Map != nullptr and Offset + Bytes <= MapStart + MapSize) {
+    return true;
+  }
+
+  unmap();
+  MapStart = Offset / PageSize * PageSize;
+  MapSize = roundUp(Offset - MapStart + Bytes, ChunkSize);
+  if (ftruncate(FileDescriptor, MapStart + MapSize) != 0) {
+    LOG(KAFKA, Sev::Error, "Unable to grow producer file {}: {}", Path,
+        strerror(errno));
+    return false;
+  }
+
+  void *Mapping = mmap(nullptr, MapSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       FileDescriptor, MapStart);
+  if (Mapping == MAP_FAILED) {
+    LOG(KAFKA, Sev::Error, "Unable to map producer file {}: {}", Path,
+        strerror(errno));
+    return false;
+  }
+  Map = static_cast<uint8_t *>(Mapping);
+  XTRACE(KAFKA, DEB, "mapped %zu bytes at %zu", MapSize, MapStart);
+  return true;
+}
+
+int FileProducer::produce(const nonstd::span<const uint8_t> &Buffer,
+                          int64_t) {
+  size_t Size = Buffer.size_bytes();
+  if (Size == 0) {
+    XTRACE(KAFKA, WAR, "empty message not written to %s", Path.c_str());
+    return -1;
+  }
+  size_t RecordSize = roundUp(SizePrefix + Size, RecordAlignment);
+  if (not reserve(RecordSize)) {
+    return -1;
+  }
+
+  uint8_t *Record = Map + (Offset - MapStart);
+  uint64_t Prefix = Size;
+  memcpy(Record, &Prefix, SizePrefix);
+  memcpy(Record + SizePrefix, Buffer.data(), Size);
+  // the file is grown with zeros, so the padding is already zero
+  Offset += RecordSize;
+
+  Messages++;
+  Bytes += Size;
+  return 0;
+}
+
+size_t FileProducer::replay(
+    const std::string &Path,
+    const std::function<void(nonstd::span<const uint8_t>)> &Message) {
+  int FileDescriptor = open(Path.c_str(), O_RDONLY);
+  if (FileDescriptor < 0) {
+    throw std::runtime_error("system error - open() of producer file failed");
+  }
+  struct stat FileStat;
+  if (fstat(FileDescriptor, &FileStat) != 0) {
+    close(FileDescriptor);
+    throw std::runtime_error("system error - fstat() of producer file failed");
+  }
+  size_t FileSize = FileStat.st_size;
+  if (FileSize == 0) {
+    close(FileDescriptor);
+    return 0;
+  }
+
+  void *Mapping =
+      mmap(nullptr, FileSize, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+  close(FileDescriptor);
+  if (Mapping == MAP_FAILED) {
+    throw std::runtime_error("system error - mmap() of producer file failed");
+  }
+
+  const uint8_t *Data = static_cast<const uint8_t *>(Mapping);
+  size_t Messages{0};
+  size_t Position{0};
+  while (Position + SizePrefix <= FileSize) {
+    uint64_t Size;
+    memcpy(&Size, Data + Position, SizePrefix);
+    // zero filled tail of the last chunk, or a record cut short
+    if (Size == 0 or Size > FileSize - Position - SizePrefix) {
+      XTRACE(KAFKA, WAR, "end of data in %s at %zu of %zu bytes",
+             Path.c_str(), Position, FileSize);
+      break;
+    }
+    Message({Data + Position + SizePrefix, Size});
+    Position += roundUp(SizePrefix + Size, RecordAlignment);
+    Messages++;
+  }
+  munmap(Mapping, FileSize);
+  return Messages;
+}
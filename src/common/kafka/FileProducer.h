@@ -0,0 +1,74 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Producer appending messages to a memory mapped file, selected with
+/// the broker URI file:///path/to/file
+///
+/// Each record is a little endian uint64_t with the message size followed by
+/// the message, padded with zeros to a multiple of 8 bytes. The messages are
+/// therefore 8 byte aligned in the file, so ev44 and da00 flatbuffers can be
+/// replayed in place from a mapping of the file, see replay().
+///
+/// The file is grown and mapped in chunks, and truncated to the written
+/// size when the producer is destroyed. If that does not happen, the file
+/// ends with the zero filled rest of the last chunk, so a zero size marks
+/// the end of the data and empty messages are not written.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <common/kafka/Producer.h>
+
+#include <functional>
+#include <string>
+
+class FileProducer : public ProducerBase {
+public:
+  static constexpr size_t DefaultChunkSize{64 * 1024 * 1024};
+
+  /// \brief create or truncate the file at Path
+  /// \param ChunkSize bytes the file is grown and mapped by, rounded up to
+  /// the page size
+  /// \throws std::runtime_error if the file can not be opened
+  FileProducer(const std::string &Path, size_t ChunkSize = DefaultChunkSize);
+
+  ~FileProducer();
+
+  FileProducer(const FileProducer &) = delete;
+  FileProducer &operator=(const FileProducer &) = delete;
+
+  /// \brief append the message to the file
+  /// \return 0 on success, -1 if the message is empty or the file could not
+  /// be grown or mapped
+  int produce(const nonstd::span<const uint8_t> &Buffer,
+              int64_t MessageTimestampMS) override;
+
+  /// \brief call Message for each message of a file written by FileProducer,
+  /// stopping at a zero size or at a record running past the end of the file
+  /// \return number of messages
+  /// \throws std::runtime_error if the file can not be read
+  static size_t
+  replay(const std::string &Path,
+         const std::function<void(nonstd::span<const uint8_t>)> &Message);
+
+  int64_t Messages{0};
+  int64_t Bytes{0}; ///< message bytes, without size prefix and padding
+
+private:
+  /// \brief map the file so that Bytes more can be written at Offset
+  bool reserve(size_t Bytes);
+
+  void unmap();
+
+  std::string Path;
+  int FileDescriptor{-1};
+  size_t PageSize{4096};
+  size_t ChunkSize{DefaultChunkSize};
+
+  size_t Offset{0};      ///< end of the written data in the file
+  uint8_t *Map{nullptr}; ///< mapping of the file from MapStart
+  size_t MapStart{0};
+  size_t MapSize{0};
+};
@@ -0,0 +1,26 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Producer discarding all messages, selected with the broker URI
+/// null:// for offline throughput measurements without Kafka
+///
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <common/kafka/Producer.h>
+
+class NullProducer : public ProducerBase {
+public:
+  /// \brief count the message and discard it
+  int produce(const nonstd::span<const uint8_t> &Buffer, int64_t) override {
+    Messages++;
+    Bytes += Buffer.size_bytes();
+    return 0;
+  }
+
+  int64_t Messages{0};
+  int64_t Bytes{0};
+};
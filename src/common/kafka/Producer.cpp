@@ -11,8 +11,12 @@
 ///
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <common/StatCounterBase.h>
+#include <common/kafka/FileProducer.h>
+#include <common/kafka/NullProducer.h>
 #include <common/kafka/Producer.h>
 #include <common/math/Units.h>
 #include <common/system/gccintel.h>
@@ -26,6 +30,30 @@ using namespace essmath::units;
 // #undef TRC_LEVEL
 // #define TRC_LEVEL TRC_L_DEB
 
+namespace {
+/// \brief copy of a buffer passed to produce() while the producer thread
+/// runs, as the caller may reuse the buffer immediately
+struct CopiedBuffer : public ProducerBufferRelease {
+  explicit CopiedBuffer(const nonstd::span<const uint8_t> &Buffer)
+      : Data(Buffer.begin(), Buffer.end()) {}
+  void release() override { delete this; }
+  std::vector<uint8_t> Data;
+};
+
+const std::string NullUri{"null://"};
+const std::string FileUri{"file://"};
+
+bool startsWith(const std::string &String, const std::string &Prefix) {
+  return String.compare(0, Prefix.size(), Prefix) == 0;
+}
+
+uint64_t steadyNowNS() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+} // namespace
+
 RdKafka::Conf::ConfResult Producer::setConfig(const std::string &Key,
                                               const std::string &Value) {
   // Don't log passwords
@@ -53,6 +81,23 @@ Producer::Producer(const std::string &Broker, const std::string &Topic,
     : ProducerBase(), TopicName(Topic),
       StatCounters(Stats, "producer." + Name) {
 
+  if (startsWith(Broker, NullUri)) {
+    LOG(KAFKA, Sev::Info, "Discarding messages for topic {}", Topic);
+    Sink = std::make_unique<NullProducer>();
+    return;
+  }
+  if (startsWith(Broker, FileUri)) {
+    std::string Path = Broker.substr(FileUri.size()) + "/" + Topic + ".bin";
+    try {
+      Sink = std::make_unique<FileProducer>(Path);
+    } catch (std::runtime_error &) {
+      LOG(KAFKA, Sev::Error, "Unable to produce topic {} to file {}", Topic,
+          Path);
+      StatCounters.ErrConfig++;
+    }
+    return;
+  }
+
   /// Perform the configuration of the Kafka producer
   Config.reset(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
   TopicConfig.reset(RdKafka::Conf::create(RdKafka::Conf::CONF_TOPIC));
@@ -125,21 +170,127 @@ Producer::Producer(const std::string &Broker, const std::string &Topic,
       StatCounters.MaxNumOfMsgInQueue, StatCounters.MaxBytesInQueue);
 }
 
+Producer::~Producer() { stopThread(); }
+
+void Producer::startThread() {
+  if (ThreadRunning or (KafkaProducer == nullptr and Sink == nullptr)) {
+    return;
+  }
+  Handoff = std::make_unique<HandoffQueue>();
+  StopThread = false;
+  ThreadRunning = true;
+  ProducerThread = std::thread(&Producer::threadLoop, this);
+  LOG(KAFKA, Sev::Info, "Kafka producer thread started for topic {}",
+      TopicName);
+}
+
+void Producer::stopThread() {
+  if (not ThreadRunning) {
+    return;
+  }
+  StopThread.store(true, std::memory_order_release);
+  HandoffWait.notify();
+  ProducerThread.join();
+  ThreadRunning = false;
+}
+
+void Producer::threadLoop() {
+  while (not StopThread.load(std::memory_order_acquire)) {
+    drainHandoff();
+    pollKafka(0);
+    HandoffWait.wait([this]() {
+      return not Handoff->wasEmpty() or
+             StopThread.load(std::memory_order_relaxed);
+    });
+  }
+  drainHandoff();
+  pollKafka(0);
+}
+
+void Producer::drainHandoff() {
+  HandoffMessage Message;
+  while (Handoff->pop(Message)) {
+    int64_t WaitUs = (steadyNowNS() - Message.QueuedNS) / 1000;
+    StatCounters.HandoffLatencyUsTotal += WaitUs;
+    HandoffLatencyUsWindowMax = std::max(HandoffLatencyUsWindowMax, WaitUs);
+    produce({Message.Data, Message.Size}, Message.MessageTimestampMS, 0,
+            Message.Release);
+  }
+}
+
+int Producer::handoff(const nonstd::span<const uint8_t> &Buffer,
+                      int64_t MessageTimestampMS,
+                      ProducerBufferRelease &Release) {
+  HandoffMessage Message{Buffer.data(), Buffer.size_bytes(),
+                         MessageTimestampMS, &Release, steadyNowNS()};
+  if (not Handoff->push(Message)) {
+    StatCounters.HandoffQueueFull++;
+    Release.release();
+    return RdKafka::ERR__QUEUE_FULL;
+  }
+  HandoffWait.notify();
+  return 0;
+}
+
+void Producer::updateLatencyMaxima() {
+  uint64_t NowNS = steadyNowNS();
+  if (NowNS - LatencyWindowStartNS < 1'000'000'000) {
+    return;
+  }
+  LatencyWindowStartNS = NowNS;
+  StatCounters.HandoffLatencyUsMax = HandoffLatencyUsWindowMax;
+  StatCounters.DeliveryLatencyUsMax = DeliveryLatencyUsWindowMax;
+  HandoffLatencyUsWindowMax = 0;
+  DeliveryLatencyUsWindowMax = 0;
+}
+
 int Producer::produce(const nonstd::span<const uint8_t> &Buffer,
                       int64_t MessageTimestampMS) {
+  if (ThreadRunning) {
+    auto *Copy = new CopiedBuffer(Buffer);
+    return handoff(Copy->Data, MessageTimestampMS, *Copy);
+  }
+  return produce(Buffer, MessageTimestampMS, RdKafka::Producer::RK_MSG_COPY,
+                 nullptr);
+}
+
+int Producer::produceZeroCopy(const nonstd::span<const uint8_t> &Buffer,
+                              int64_t MessageTimestampMS,
+                              ProducerBufferRelease &Release) {
+  if (ThreadRunning) {
+    return handoff(Buffer, MessageTimestampMS, Release);
+  }
+  // without any flag librdkafka neither copies nor frees the payload
+  return produce(Buffer, MessageTimestampMS, 0, &Release);
+}
+
+int Producer::produce(const nonstd::span<const uint8_t> &Buffer,
+                      int64_t MessageTimestampMS, int MsgFlags,
+                      ProducerBufferRelease *Opaque) {
+
+  if (Sink) {
+    return produceToSink(Buffer, MessageTimestampMS, Opaque);
+  }
 
   if (KafkaProducer == nullptr || KafkaTopic == nullptr) {
+    if (Opaque != nullptr) {
+      Opaque->release();
+    }
     return RdKafka::ERR_UNKNOWN;
   }
 
-  // non-blocking, copies the buffer to kafka thread for transfer
+  // non-blocking, the buffer is copied or referenced by the kafka thread
   auto error = KafkaProducer->produce(
-      TopicName, -1, RdKafka::Producer::RK_MSG_COPY,
-      const_cast<uint8_t *>(Buffer.data()), Buffer.size_bytes(), NULL, 0,
-      MessageTimestampMS, NULL);
+      TopicName, -1, MsgFlags, const_cast<uint8_t *>(Buffer.data()),
+      Buffer.size_bytes(), NULL, 0, MessageTimestampMS, Opaque);
+
+  // not enqueued, so there will be no delivery report for this buffer
+  if (error != RdKafka::ERR_NO_ERROR and Opaque != nullptr) {
+    Opaque->release();
+  }
 
   // Poll to handle delivery reports and events
-  poll(0);
+  pollKafka(0);
 
   StatCounters.ProduceCalls++;
 
@@ -160,6 +311,30 @@ int Producer::produce(const nonstd::span<const uint8_t> &Buffer,
   return 0;
 }
 
+int Producer::produceToSink(const nonstd::span<const uint8_t> &Buffer,
+                           int64_t MessageTimestampMS,
+                           ProducerBufferRelease *Opaque) {
+  int Error = Sink->produce(Buffer, MessageTimestampMS);
+  if (Opaque != nullptr) {
+    Opaque->release();
+  }
+
+  StatCounters.ProduceCalls++;
+  if (Error != 0) {
+    StatCounters.ProduceError++;
+    StatCounters.ProduceBytesError += Buffer.size_bytes();
+    return Error;
+  }
+
+  // written synchronously, so also delivered
+  StatCounters.ProduceBytesOk += Buffer.size_bytes();
+  StatCounters.TotalMsgDeliveryEvent++;
+  StatCounters.MsgDeliverySuccess++;
+  StatCounters.MsgStatusPersisted++;
+  StatCounters.BytesTransmittedToBrokers += Buffer.size_bytes();
+  return 0;
+}
+
 /// \brief Event callback override
 /// Handles error events from librdkafka
 void Producer::event_cb(RdKafka::Event &event) {
@@ -200,6 +375,19 @@ void Producer::dr_cb(RdKafka::Message &message) {
     StatCounters.MsgDeliverySuccess++;
     StatCounters.BytesTransmittedToBrokers += message.len();
   }
+
+  int64_t LatencyUs = message.latency();
+  if (LatencyUs >= 0) {
+    StatCounters.DeliveryLatencyUsTotal += LatencyUs;
+    DeliveryLatencyUsWindowMax =
+        std::max(DeliveryLatencyUsWindowMax, LatencyUs);
+  }
+
+  // buffers produced by produceZeroCopy() can be reused now
+  auto *Release = static_cast<ProducerBufferRelease *>(message.msg_opaque());
+  if (Release != nullptr) {
+    Release->release();
+  }
 }
 
 void Producer::applyKafkaErrorCode(RdKafka::ErrorCode ErrorCode) {
@@ -20,9 +20,13 @@
 #include <common/debug/Log.h>
 #include <common/debug/Trace.h>
 #include <common/memory/Buffer.h>
+#include <common/memory/SPSCFifo.h>
 #include <common/memory/span.hpp>
+#include <common/system/WaitStrategy.h>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <thread>
 #include <unordered_map> // add if not already included
 #include <utility>
 #include <vector>
@@ -32,6 +36,15 @@
 extern "C" int malloc_trim(size_t pad);
 #endif
 
+/// \brief Returned to its owner once the producer no longer reads a buffer
+/// passed to ProducerBase::produceZeroCopy(). This can be called from the
+/// thread serving the librdkafka delivery reports.
+class ProducerBufferRelease {
+public:
+  virtual ~ProducerBufferRelease() = default;
+  virtual void release() = 0;
+};
+
 ///
 class ProducerBase {
 public:
@@ -47,12 +60,38 @@ public:
   /// \return Returns 0 on success, another value on failure.
   virtual int produce(const nonstd::span<const uint8_t> &Buffer,
                       int64_t MessageTimestampMS) = 0;
+
+  /// \brief Send data without copying it. The buffer must not be changed
+  /// before Release.release() has been called, which happens exactly once
+  /// per call. The default implementation copies the buffer and releases it
+  /// immediately.
+  /// \param Release called when the buffer can be reused
+  /// \return Returns 0 on success, another value on failure.
+  virtual int produceZeroCopy(const nonstd::span<const uint8_t> &Buffer,
+                              int64_t MessageTimestampMS,
+                              ProducerBufferRelease &Release) {
+    int Result = produce(Buffer, MessageTimestampMS);
+    Release.release();
+    return Result;
+  }
 };
 
 /// \brief The Producer class is responsible for producing Kafka messages and
 /// sending them to the cluster.
 ///
 /// It inherits from ProducerBase and RdKafka::EventCb.
+///
+/// By default librdkafka is called from the thread calling produce() and
+/// poll(). After startThread() a producer thread owns the librdkafka handle
+/// and polls it continuously. produce() and produceZeroCopy() then only pass
+/// the buffer to that thread through a lock-free single producer queue, so
+/// they must all be called from one thread.
+///
+/// Brokers given as null:// or file:///directory select a NullProducer or a
+/// FileProducer writing directory/<topic>.bin instead of librdkafka, for
+/// measurements without a Kafka cluster. Produced messages are then counted
+/// as delivered and persisted immediately. If the file can not be opened
+/// this is counted as a configuration error and the messages are dropped.
 class Producer : public ProducerBase,
                  public RdKafka::EventCb,
                  public RdKafka::DeliveryReportCb {
@@ -60,7 +99,7 @@ public:
   /// \brief Constructs a Producer object.
   ///
   /// \param Broker The 'URL' specifying the host and port, for example,
-  /// "127.0.0.1:9009".
+  /// "127.0.0.1:9009", or null:// or file:///directory, see above.
   /// \param Topic The name of the Kafka topic according to the agreement, for
   /// example, "trex_detector".
   /// \param Configs A vector of configuration <type,value> pairs.
@@ -70,8 +109,16 @@ public:
            std::vector<std::pair<std::string, std::string>> &Configs,
            Statistics &Stats, const std::string &Name = "event");
 
-  /// \brief Cleans up by deleting allocated structures.
-  ~Producer() = default;
+  /// \brief Stops the producer thread, if started, and cleans up by deleting
+  /// allocated structures.
+  ~Producer();
+
+  /// \brief Start the producer thread, see class description
+  void startThread();
+
+  /// \brief Stop the producer thread after it has produced the queued
+  /// buffers. Does nothing if the thread is not running.
+  void stopThread();
 
   /// \brief Structure to hold producer statistics.
   struct ProducerStats : public StatCounterBase {
@@ -86,8 +133,20 @@ public:
     /// \brief Count of malloc_trim calls made
     int64_t MallocTrimCalls{0};
 
+    // producer thread and latency statistics
+    /// \brief Count of buffers dropped as the handoff queue was full
+    int64_t HandoffQueueFull{0};
+    /// \brief Summed time (us) buffers waited for the producer thread
+    int64_t HandoffLatencyUsTotal{0};
+    /// \brief Longest wait (us) for the producer thread in the last second
+    int64_t HandoffLatencyUsMax{0};
+    /// \brief Summed time (us) from enqueue in librdkafka to delivery report
+    int64_t DeliveryLatencyUsTotal{0};
+    /// \brief Longest delivery report latency (us) in the last second
+    int64_t DeliveryLatencyUsMax{0};
+
     // librdkafka errors
-    /// \brief Count errors during librdkafka config operations
+    /// \brief Count errors during librdkafka or file:// sink configuration
     int64_t ErrConfig{0};
     /// \brief Count of timeout errors
     int64_t ErrTimeout{0};
@@ -158,6 +217,14 @@ public:
                /// performance indicators
                {"memory_cleanups", MallocTrimCalls},
 
+               /// producer thread and latency, serialize to delivery report
+               /// is the sum of the handoff and delivery latencies
+               {"handoff.queue_full", HandoffQueueFull},
+               {"latency.handoff_us_total", HandoffLatencyUsTotal},
+               {"latency.handoff_us_max", HandoffLatencyUsMax},
+               {"latency.delivery_us_total", DeliveryLatencyUsTotal},
+               {"latency.delivery_us_max", DeliveryLatencyUsMax},
+
                /// librdkafka transmission stats
                {"brokers.tx_bytes", BytesTransmittedToBrokers},
                {"brokers.tx_req_retries", TxRequestRetries},
@@ -190,16 +257,14 @@ public:
   } __attribute__((aligned(64)));
 
   /// \brief Polls the producer for events and checks queue length.
-  /// and triggers memory recovery if needed (Linux only).
+  /// and triggers memory recovery if needed (Linux only). Does nothing while
+  /// the producer thread is running, as that thread polls.
   /// \param TimeoutMS The timeout in milliseconds for polling.
   inline void poll(int TimeoutMS) {
-    if (!KafkaProducer)
+    if (ThreadRunning)
       return;
 
-    tryMemoryRecovery();
-
-    KafkaProducer->poll(TimeoutMS);
-    StatCounters.NumberOfMsgInQueue = KafkaProducer->outq_len();
+    pollKafka(TimeoutMS);
   };
 
   /// \brief Delivery report callback. This function is called when we
@@ -220,10 +285,19 @@ public:
   ///
   /// \param Buffer The buffer containing the message data.
   /// \param MessageTimestampMS The timestamp of the message in milliseconds.
-  /// \return int Returns 0 if the operation is successful or an error code
+  /// \return int Returns 0 if the operation is successful or an error code.
+  /// With the producer thread, 0 means queued for that thread, which counts
+  /// later errors in the statistics.
   int produce(const nonstd::span<const uint8_t> &Buffer,
               int64_t MessageTimestampMS) override;
 
+  /// \brief As produce(), but librdkafka sends the buffer in place instead of
+  /// copying it. The buffer is released from dr_cb() once its delivery report
+  /// is received, or immediately if it could not be enqueued.
+  int produceZeroCopy(const nonstd::span<const uint8_t> &Buffer,
+                      int64_t MessageTimestampMS,
+                      ProducerBufferRelease &Release) override;
+
   /// \brief Sets a Kafka configuration and checks the result.
   ///
   /// \param Key The configuration key.
@@ -280,6 +354,70 @@ private:
   }
 
   void applyKafkaErrorCode(RdKafka::ErrorCode ErrorCode);
+
+  /// \brief buffer waiting for the producer thread
+  struct HandoffMessage {
+    const uint8_t *Data{nullptr};
+    size_t Size{0};
+    int64_t MessageTimestampMS{0};
+    ProducerBufferRelease *Release{nullptr};
+    uint64_t QueuedNS{0};
+  };
+  static constexpr size_t HandoffQueueSize{1024};
+  using HandoffQueue =
+      memory_relaxed_acquire_release::CircularFifo<HandoffMessage,
+                                                   HandoffQueueSize>;
+
+  /// \brief queue a buffer for the producer thread, released and counted
+  /// as an error if the queue is full
+  int handoff(const nonstd::span<const uint8_t> &Buffer,
+              int64_t MessageTimestampMS, ProducerBufferRelease &Release);
+
+  /// \brief producer thread, produces queued buffers and polls
+  void threadLoop();
+
+  /// \brief produces the buffers in the handoff queue
+  void drainHandoff();
+
+  /// \brief poll() without the producer thread check
+  void pollKafka(int TimeoutMS) {
+    if (!KafkaProducer)
+      return;
+
+    tryMemoryRecovery();
+
+    KafkaProducer->poll(TimeoutMS);
+    StatCounters.NumberOfMsgInQueue = KafkaProducer->outq_len();
+    updateLatencyMaxima();
+  }
+
+  /// \brief publish the latency maxima once per second
+  void updateLatencyMaxima();
+
+  std::unique_ptr<HandoffQueue> Handoff;
+  WaitStrategy HandoffWait{WaitStrategy::Mode::Adaptive, 1000};
+  std::thread ProducerThread;
+  std::atomic<bool> ThreadRunning{false};
+  std::atomic<bool> StopThread{false};
+
+  /// latency maxima of the current one second window
+  uint64_t LatencyWindowStartNS{0};
+  int64_t HandoffLatencyUsWindowMax{0};
+  int64_t DeliveryLatencyUsWindowMax{0};
+
+  /// \brief sink replacing librdkafka for null:// and file:// brokers
+  std::unique_ptr<ProducerBase> Sink;
+
+  /// \brief produce() to the sink, which writes the buffer synchronously
+  int produceToSink(const nonstd::span<const uint8_t> &Buffer,
+                    int64_t MessageTimestampMS, ProducerBufferRelease *Opaque);
+
+  /// \brief common part of produce() and produceZeroCopy()
+  /// \param MsgFlags RK_MSG_COPY, or 0 to send the buffer in place
+  /// \param Opaque passed back to dr_cb() as the message opaque
+  int produce(const nonstd::span<const uint8_t> &Buffer,
+              int64_t MessageTimestampMS, int MsgFlags,
+              ProducerBufferRelease *Opaque);
 };
 
 using ProducerCallback =
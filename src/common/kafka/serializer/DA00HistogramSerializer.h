@@ -1,4 +1,4 @@
-// Copyright (C) 2024 - 2025 European Spallation Source, ERIC. see LICENSE file
+// Copyright (C) 2024 - 2026 European Spallation Source, ERIC. see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -131,6 +131,9 @@ struct HistogramSerializerStats : public SerializerStats {
 /// The HistogramSerializer class is responsible for building a 1D histogram for
 /// a certain time period for serialization. It provides methods to add data to
 /// the histogram, serialize the data, and initialize the time X-axis values.
+///
+/// The bins are written straight into the flatbuffer builder at produce time,
+/// and with the default sum aggregation without calling AggregateFunction.
 template <typename T, typename R, typename V>
 class HistogramSerializer : public AbstractSerializer {
 private:
@@ -179,6 +182,7 @@ private:
   R MinValue;
   R MaxValue;
   R Step;
+  bool SumAggregation{false}; ///< AggregateFunction is essmath::sum<T>
 
 public:
   // clang-format off
@@ -244,6 +248,11 @@ public:
     MaxValue = XAxisValues.back();                           // maximum value
     Step = (MaxValue - MinValue) / (XAxisValues.size() - 1); // step size
 
+    // Summed bins are copied as they are, without calling AggregateFunction
+    using SumFunc_t = T (*)(const std::pair<T, uint32_t> &);
+    auto Func = AggregateFunction.template target<SumFunc_t>();
+    SumAggregation = Func != nullptr && *Func == &essmath::sum<T>;
+
     // Setup vector for summation of data
     SummedAxis = AxisData_t(AggregatedFrames, 0);
     SummedData = SummedData_t(AggregatedFrames, 0);
@@ -268,7 +277,7 @@ public:
   explicit HistogramSerializer(const HistogramSerializer &other)
       : AbstractSerializer(other), Source(other.Source), Period(other.Period),
         BinCount(other.BinCount), SignalUnit(other.SignalUnit), 
-        Stats(other.Stats), BinOffset(BinOffset),
+        Stats(other.Stats), BinOffset(other.BinOffset),
         AggregateFunction(other.AggregateFunction),
         BinningStrategy(other.BinningStrategy), BinSizes(other.BinSizes),
         AggregatedFrames(other.AggregatedFrames), DataBins(other.DataBins),
@@ -276,7 +285,8 @@ public:
         SummedAxis(other.SummedAxis), SummedData(other.SummedData), 
         SummedAxisIter(other.SummedAxisIter), SummedDataIter(other.SummedDataIter),
         XAxisValues(other.XAxisValues), BufferBuilder(other.BufferBuilder),
-        MinValue(other.MinValue), MaxValue(other.MaxValue),Step(other.Step){}
+        MinValue(other.MinValue), MaxValue(other.MaxValue),Step(other.Step),
+        SumAggregation(other.SumAggregation) {}
 
   /// \brief This function finds the bin index for a given time.
   /// \note This function marked virtual for testing purposes.
@@ -387,48 +397,44 @@ private:
     }
 
     bool emptyBins = true;
-    std::transform(DataBins.begin(), DataBins.end(), BinnedData.begin(), 
-      [&](auto& Data) {
-        if (Data.second > 0) {
-          emptyBins = false;
-        }
-        const auto result = AggregateFunction(Data);
-        //Set content in data bins to zero now when we have access
-        //to the element
-        Data.first = 0;
-        Data.second = 0;
-        return result;
+    if (SumAggregation) {
+      for (size_t i = 0; i < DataBins.size(); ++i) {
+        emptyBins &= DataBins[i].second == 0;
+        BinnedData[i] = DataBins[i].first;
+        DataBins[i] = {0, 0};
       }
-    );
+    } else {
+      std::transform(DataBins.begin(), DataBins.end(), BinnedData.begin(),
+        [&](auto& Data) {
+          if (Data.second > 0) {
+            emptyBins = false;
+          }
+          const auto result = AggregateFunction(Data);
+          //Set content in data bins to zero now when we have access
+          //to the element
+          Data.first = 0;
+          Data.second = 0;
+          return result;
+        }
+      );
+    }
 
     if (!emptyBins) {
-      auto XAxis = (da00flatbuffers::Variable("frame_time", {"frame_time"},
-                                              {static_cast<int64_t>(BinCount) + 1})
-                        .unit("ns")
-                        .data(XAxisValues));
-
-      auto YAxis =
-          (da00flatbuffers::Variable("signal", {"frame_time"},
-                                    {static_cast<int64_t>(BinCount)})
-              .unit(SignalUnit)
-              .data(BinnedData));
-
-      auto ZAxis =
-          (da00flatbuffers::Variable("reference_time", {"reference_time"},
-                                    {static_cast<int64_t>(AggregatedFrames)})
-              .unit("ns")
-              .data(SummedAxis));
-
-      auto WAxis =
-          (da00flatbuffers::Variable("frame_total", {"reference_time"},
-                                    {static_cast<int64_t>(AggregatedFrames)})
-              .unit("counts")
-              .data(SummedData));
-
-      const auto DataArray = da00flatbuffers::DataArray(
-          Source, ReferenceTime.value(), {XAxis, YAxis, ZAxis, WAxis});
-
-      BufferBuilder.Finish(DataArray.pack(BufferBuilder), da00_DataArrayIdentifier());
+      // The variables are packed straight from the histogram vectors, the
+      // same content as da00flatbuffers::Variable::pack() without first
+      // copying the data into Variable and DataArray objects
+      std::vector<flatbuffers::Offset<da00_Variable>> Variables{
+          packVariable("frame_time", "frame_time", "ns", XAxisValues),
+          packVariable("signal", "frame_time", SignalUnit, BinnedData),
+          packVariable("reference_time", "reference_time", "ns", SummedAxis),
+          packVariable("frame_total", "reference_time", "counts", SummedData)};
+
+      const auto SourceOffset = BufferBuilder.CreateString(Source);
+      const auto VariablesOffset = BufferBuilder.CreateVector(Variables);
+      BufferBuilder.Finish(
+          Createda00_DataArray(BufferBuilder, SourceOffset,
+                               ReferenceTime.value().count(), VariablesOffset),
+          da00_DataArrayIdentifier());
       // Create a detached buffer for AbstractSerializer produce method. Detached buffer
       // wrap a pointer and size to internal buffer builder objects.
       Buffer = BufferBuilder.Release();
@@ -439,6 +445,30 @@ private:
     }
   }
 
+  /// \brief Pack a one dimensional da00 variable into BufferBuilder
+  /// \param Name variable name
+  /// \param Axis name of the single axis, the shape is the data size
+  /// \param Unit variable unit
+  /// \param Data values, copied into the flatbuffer as raw bytes
+  template <typename D>
+  flatbuffers::Offset<da00_Variable>
+  packVariable(const std::string &Name, const std::string &Axis,
+               const std::string &Unit, const std::vector<D> &Data) {
+    const std::vector<std::string> Axes{Axis};
+    const std::vector<int64_t> Shape{static_cast<int64_t>(Data.size())};
+
+    const auto UnitOffset = BufferBuilder.CreateString(Unit);
+    const auto NameOffset = BufferBuilder.CreateString(Name);
+    const auto AxesOffset = BufferBuilder.CreateVectorOfStrings(Axes);
+    const auto ShapeOffset = BufferBuilder.CreateVector(Shape);
+    const auto DataOffset = BufferBuilder.CreateVector(
+        reinterpret_cast<const uint8_t *>(Data.data()),
+        Data.size() * sizeof(D));
+    return Createda00_Variable(BufferBuilder, NameOffset, UnitOffset, 0, 0,
+                               DataTypeTrait<D>::type, AxesOffset, ShapeOffset,
+                               DataOffset);
+  }
+
   /// \brief Initialize the X-axis values.
   /// \details The X-axis values are initialized based on the period and
   /// number of bins. These values are cannot be negative the algorithm
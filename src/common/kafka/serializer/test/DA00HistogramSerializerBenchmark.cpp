@@ -0,0 +1,72 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief HistogramSerializer throughput with the CBM template types
+///
+/// Events with random times within the 71 ms ESS pulse period are added to
+/// a histogram with the bin count given as argument. The second benchmark
+/// also changes the reference time every 10000 events, which serializes the
+/// histogram as a beam monitor does once per pulse.
+
+#include <benchmark/benchmark.h>
+#include <common/kafka/serializer/DA00HistogramSerializer.h>
+#include <random>
+
+using Serializer_t = fbserializer::HistogramSerializer<int32_t, int32_t, uint64_t>;
+
+static constexpr int32_t Period{71'428'571};
+static constexpr size_t EventsPerPulse{10'000};
+
+static std::vector<int32_t> randomTimes(size_t Count) {
+  std::mt19937 Random(1);
+  std::uniform_int_distribution<int32_t> Time(0, Period + Period / 100);
+  std::vector<int32_t> Times(Count);
+  for (auto &T : Times) {
+    T = Time(Random);
+  }
+  return Times;
+}
+
+static void AddEvent(benchmark::State &state) {
+  int32_t BinCount = state.range(0);
+  auto Times = randomTimes(EventsPerPulse);
+  Serializer_t Serializer("cbm", Period, BinCount, "A",
+                          fbserializer::BinningStrategy::LastBin);
+  Serializer.checkAndSetReferenceTime(esstime::TimeDurationNano(1));
+
+  int64_t Events{0};
+  for (auto _ : state) {
+    for (auto Time : Times) {
+      Serializer.addEvent(Time, 1);
+    }
+    Events += Times.size();
+  }
+  state.SetItemsProcessed(Events);
+}
+BENCHMARK(AddEvent)->Arg(100)->Arg(1000)->Arg(10'000);
+
+static void AddEventAndProduce(benchmark::State &state) {
+  int32_t BinCount = state.range(0);
+  auto Times = randomTimes(EventsPerPulse);
+  int64_t Produced{0};
+  Serializer_t Serializer(
+      "cbm", Period, BinCount, "A", fbserializer::BinningStrategy::LastBin, 1,
+      [&Produced](nonstd::span<const uint8_t> Buffer, int64_t) {
+        Produced += Buffer.size();
+      });
+
+  int64_t Pulse{1};
+  int64_t Events{0};
+  for (auto _ : state) {
+    Serializer.checkAndSetReferenceTime(esstime::TimeDurationNano(Pulse++));
+    for (auto Time : Times) {
+      Serializer.addEvent(Time, 1);
+    }
+    Events += Times.size();
+  }
+  benchmark::DoNotOptimize(Produced);
+  state.SetItemsProcessed(Events);
+}
+BENCHMARK(AddEventAndProduce)->Arg(100)->Arg(1000)->Arg(10'000);
+
+BENCHMARK_MAIN();
@@ -1,4 +1,4 @@
-// Copyright (C) 2024 European Spallation Source, ERIC. see LICENSE file
+// Copyright (C) 2024 - 2026 European Spallation Source, ERIC. see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -1061,6 +1061,34 @@ TEST_F(HistogramSerializerTest, TestBinOffset) {
   EXPECT_EQ(serializer.stats().DataOverPeriodLastBin, 0);
 }
 
+TEST_F(HistogramSerializerTest, TestCustomAggregationFunction) {
+  using Validator_t = TestValidator<int64_t, int64_t, uint64_t>;
+  /// Setup test condition
+  CommonFbMembers.setPeriod(20).setBinSize(2).setReferenceTime(
+      std::chrono::seconds(10));
+
+  // Bins hold the number of events, not the sum of the values
+  std::vector<Validator_t::ResultData_t> ExpectedResultData = {2, 1};
+  std::vector<Validator_t::ReferenceTime_t> ExpectedReferenceData = {0};
+  std::vector<Validator_t::SumValue_t> ExpectedIntensityData = {13};
+
+  Validator_t Validator{CommonFbMembers, 
+    ExpectedResultData,
+    ExpectedReferenceData,
+    ExpectedIntensityData};
+
+  auto serializer = Validator.createHistogramSerializer(
+      fbserializer::BinningStrategy::Drop,
+      [](std::pair<int64_t, uint32_t> Bin) -> int64_t { return Bin.second; });
+
+  /// Perform test
+  serializer.checkAndSetReferenceTime(CommonFbMembers.ReferenceTime);
+  serializer.addEvent(3, 5);
+  serializer.addEvent(4, 7);
+  serializer.addEvent(12, 1);
+  serializer.produce();
+}
+
 TEST_F(HistogramSerializerTest, TestAllowedTypeTemplates) {
   using InCompleteList_t = fbserializer::AllowedList<int8_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t, float, double>;
   using CompleteList_t = fbserializer::AllowedList<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t, float, double>;
@@ -1,4 +1,4 @@
-// Copyright (C) 2023 European Spallation Source, ERIC. see LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -12,6 +12,7 @@
 #include <common/kafka/Producer.h>
 #include <common/testutils/TestBase.h>
 #include <cstring>
+#include <vector>
 
 
 struct MockProducer {
@@ -32,6 +33,33 @@ class AR51SerializerTest : public TestBase {
 protected:
   uint8_t RawData[9000];
   AR51Serializer ar52{"nameless"};
+
+  /// raw_data and source_name of every produced message
+  std::vector<std::vector<uint8_t>> Messages;
+  std::vector<std::string> SourceNames;
+  AR51Serializer Batcher{"nameless",
+                         [this](nonstd::span<const uint8_t> Buffer, int64_t) {
+                           auto Message = GetRawReadoutMessage(Buffer.data());
+                           auto Raw = Message->raw_data();
+                           Messages.emplace_back(Raw->Data(),
+                                                 Raw->Data() + Raw->size());
+                           SourceNames.push_back(Message->source_name()->str());
+                         }};
+
+  /// split the raw_data of a batched message into packet lengths
+  std::vector<uint32_t> packetLengths(const std::vector<uint8_t> &Raw) {
+    std::vector<uint32_t> Lengths;
+    size_t Offset{0};
+    while (Offset < Raw.size()) {
+      uint32_t Length;
+      std::memcpy(&Length, &Raw[Offset], sizeof(Length));
+      EXPECT_EQ(std::memcmp(&Raw[Offset + sizeof(Length)], RawData, Length), 0);
+      Lengths.push_back(Length);
+      Offset += sizeof(Length) + Length;
+    }
+    EXPECT_EQ(Offset, Raw.size());
+    return Lengths;
+  }
 };
 
 
@@ -46,6 +74,83 @@ TEST_F(AR51SerializerTest, Serialize) {
   }
 }
 
+TEST_F(AR51SerializerTest, AddPacketWithoutBatching) {
+  ASSERT_EQ(Batcher.addPacket(RawData, 100) > 100, true);
+  ASSERT_EQ(Batcher.addPacket(RawData, 200) > 200, true);
+  ASSERT_EQ(Batcher.flush(), 0);
+
+  ASSERT_EQ(Messages.size(), 2);
+  ASSERT_EQ(Messages[0], std::vector<uint8_t>(RawData, RawData + 100));
+  ASSERT_EQ(Messages[1], std::vector<uint8_t>(RawData, RawData + 200));
+  ASSERT_EQ(Batcher.SeqNum, 2);
+}
+
+TEST_F(AR51SerializerTest, BatchingByteBudget) {
+  Batcher.setBatching(1000, 1'000'000'000);
+
+  // 104 bytes per packet with the length, nine packets fit in a batch
+  for (int i = 0; i < 20; i++) {
+    Batcher.addPacket(RawData, 100);
+  }
+  ASSERT_EQ(Messages.size(), 2);
+  ASSERT_EQ(packetLengths(Messages[0]), std::vector<uint32_t>(9, 100));
+  ASSERT_EQ(packetLengths(Messages[1]), std::vector<uint32_t>(9, 100));
+
+  ASSERT_TRUE(Batcher.flush() > 0);
+  ASSERT_EQ(Messages.size(), 3);
+  ASSERT_EQ(packetLengths(Messages[2]), std::vector<uint32_t>(2, 100));
+  ASSERT_EQ(Batcher.flush(), 0);
+  ASSERT_EQ(Batcher.SeqNum, 3);
+}
+
+TEST_F(AR51SerializerTest, BatchingPacketAboveBudget) {
+  Batcher.setBatching(1000, 1'000'000'000);
+
+  Batcher.addPacket(RawData, 10);
+  ASSERT_TRUE(Messages.empty());
+
+  // produces the pending packet, then the large one on its own
+  Batcher.addPacket(RawData, 9000);
+  ASSERT_EQ(Messages.size(), 2);
+  ASSERT_EQ(packetLengths(Messages[0]), std::vector<uint32_t>({10}));
+  ASSERT_EQ(packetLengths(Messages[1]), std::vector<uint32_t>({9000}));
+  ASSERT_EQ(Batcher.flush(), 0);
+}
+
+TEST_F(AR51SerializerTest, BatchingTimeBudget) {
+  Batcher.setBatching(100'000, 3'600'000'000'000);
+  ASSERT_EQ(Batcher.checkTimeout(), 0);
+  Batcher.addPacket(RawData, 100);
+  ASSERT_EQ(Batcher.checkTimeout(), 0);
+  ASSERT_TRUE(Messages.empty());
+
+  // changing the budget produces the pending batch
+  Batcher.setBatching(100'000, 0);
+  ASSERT_EQ(Messages.size(), 1);
+
+  Batcher.addPacket(RawData, 100);
+  Batcher.addPacket(RawData, 50);
+  ASSERT_TRUE(Batcher.checkTimeout() > 0);
+  ASSERT_EQ(Messages.size(), 2);
+  ASSERT_EQ(packetLengths(Messages[1]), std::vector<uint32_t>({100, 50}));
+  ASSERT_EQ(Batcher.checkTimeout(), 0);
+}
+
+TEST_F(AR51SerializerTest, BatchedSourceName) {
+  Batcher.addPacket(RawData, 100);
+  Batcher.setBatching(1000, 1'000'000'000);
+  Batcher.addPacket(RawData, 100);
+  Batcher.flush();
+  Batcher.setBatching(0, 0);
+  Batcher.addPacket(RawData, 100);
+
+  ASSERT_EQ(SourceNames, std::vector<std::string>(
+                             {"nameless", "nameless_batch", "nameless"}));
+  ASSERT_EQ(Messages[0], std::vector<uint8_t>(RawData, RawData + 100));
+  ASSERT_EQ(packetLengths(Messages[1]), std::vector<uint32_t>({100}));
+  ASSERT_EQ(Messages[2], Messages[0]);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -18,6 +18,40 @@ struct MockProducer {
   size_t NumberOfCalls{0};
 };
 
+/// Keeps zero copy buffers until released by the test
+struct HoldingProducer : public ProducerBase {
+  int produce(const nonstd::span<const uint8_t> &, int64_t) override {
+    Copies++;
+    return 0;
+  }
+
+  int produceZeroCopy(const nonstd::span<const uint8_t> &Buffer, int64_t,
+                      ProducerBufferRelease &Release) override {
+    Held.push_back({Buffer, &Release});
+    return 0;
+  }
+
+  void releaseAll() {
+    for (auto &Message : Held) {
+      Message.second->release();
+    }
+    Held.clear();
+  }
+
+  size_t Copies{0};
+  std::vector<std::pair<nonstd::span<const uint8_t>, ProducerBufferRelease *>>
+      Held;
+};
+
+/// Only implements the copying produce()
+struct CopyingProducer : public ProducerBase {
+  int produce(const nonstd::span<const uint8_t> &, int64_t) override {
+    Copies++;
+    return 0;
+  }
+  size_t Copies{0};
+};
+
 class EV44SerializerTest : public TestBase {
   void SetUp() override {
     for (int i = 0; i < 200000; i++) {
@@ -127,6 +161,95 @@ TEST_F(EV44SerializerTest, AutoDeserialize) {
   EXPECT_EQ(mp.NumberOfCalls, 1);
 }
 
+TEST_F(EV44SerializerTest, ZeroCopyUsesFreeBuffers) {
+  HoldingProducer Producer;
+  EV44Serializer Serializer(ARRAYLENGTH, "nameless", Producer, 2);
+
+  Serializer.addEvent(1, 1);
+  EXPECT_GT(Serializer.produce(), 0);
+  ASSERT_EQ(Producer.Held.size(), 1);
+  EXPECT_EQ(Serializer.stats().ProduceZeroCopy, 1);
+
+  // the other buffer is still in flight, so this one is copied and reused
+  Serializer.addEvent(2, 2);
+  EXPECT_GT(Serializer.produce(), 0);
+  EXPECT_EQ(Producer.Held.size(), 1);
+  EXPECT_EQ(Producer.Copies, 1);
+  EXPECT_EQ(Serializer.stats().ProduceCopied, 1);
+
+  Producer.releaseAll();
+  Serializer.addEvent(3, 3);
+  Serializer.produce();
+  Serializer.addEvent(4, 4);
+  Serializer.produce();
+  ASSERT_EQ(Producer.Held.size(), 1);
+  EXPECT_EQ(Producer.Copies, 2);
+  EXPECT_EQ(Serializer.stats().ProduceZeroCopy, 2);
+  Producer.releaseAll();
+}
+
+TEST_F(EV44SerializerTest, ZeroCopyBufferUnchangedWhileInFlight) {
+  HoldingProducer Producer;
+  EV44Serializer Serializer(ARRAYLENGTH, "nameless", Producer, 3);
+  Serializer.setReferenceTime(300000000000);
+
+  for (int i = 0; i < ARRAYLENGTH; i++) {
+    Serializer.addEvent(time[i], pixel[i]); // produces at the last event
+  }
+  ASSERT_EQ(Producer.Held.size(), 1);
+
+  for (int i = 0; i < ARRAYLENGTH - 1; i++) {
+    Serializer.addEvent(-1, -1);
+  }
+  EXPECT_EQ(Serializer.referenceTime(), 300000000000);
+  Serializer.produce();
+  ASSERT_EQ(Producer.Held.size(), 2);
+
+  auto Buffer = Producer.Held[0].first;
+  auto veri = flatbuffers::Verifier(Buffer.data(), Buffer.size_bytes());
+  ASSERT_TRUE(VerifyEvent44MessageBuffer(veri));
+  auto Events = GetEvent44Message(Buffer.data());
+  EXPECT_EQ(Events->message_id(), 1);
+  EXPECT_EQ((*Events->reference_time())[0], 300000000000);
+  ASSERT_EQ(Events->time_of_flight()->size(), ARRAYLENGTH);
+  for (int i = 0; i < ARRAYLENGTH; i++) {
+    EXPECT_EQ((*Events->time_of_flight())[i], time[i]);
+    EXPECT_EQ((*Events->pixel_id())[i], pixel[i]);
+  }
+
+  Buffer = Producer.Held[1].first;
+  Events = GetEvent44Message(Buffer.data());
+  EXPECT_EQ(Events->message_id(), 2);
+  EXPECT_EQ((*Events->reference_time())[0], 300000000000);
+  EXPECT_EQ(Events->time_of_flight()->size(), ARRAYLENGTH - 1);
+  Producer.releaseAll();
+}
+
+TEST_F(EV44SerializerTest, ZeroCopyReleasedAfterDestruction) {
+  HoldingProducer Producer;
+  {
+    EV44Serializer Serializer(ARRAYLENGTH, "nameless", Producer);
+    Serializer.addEvent(1, 1);
+    Serializer.produce();
+  }
+  ASSERT_EQ(Producer.Held.size(), 1);
+  auto Events = GetEvent44Message(Producer.Held[0].first.data());
+  EXPECT_EQ(Events->source_name()->str(), "nameless");
+  Producer.releaseAll();
+}
+
+TEST_F(EV44SerializerTest, ZeroCopyDefaultProducerCopies) {
+  CopyingProducer Producer;
+  EV44Serializer Serializer(ARRAYLENGTH, "nameless", Producer);
+  for (int i = 0; i < 3; i++) {
+    Serializer.addEvent(i, i);
+    Serializer.produce();
+  }
+  EXPECT_EQ(Producer.Copies, 3);
+  EXPECT_EQ(Serializer.stats().ProduceZeroCopy, 3);
+  EXPECT_EQ(Serializer.stats().ProduceCopied, 0);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,144 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief Unit tests for the file and null producers
+//===----------------------------------------------------------------------===//
+
+#include <common/kafka/FileProducer.h>
+#include <common/kafka/NullProducer.h>
+#include <common/testutils/SaveBuffer.h>
+#include <common/testutils/TestBase.h>
+#include <fstream>
+#include <numeric>
+
+std::string ProducerFile{"deleteme_file_producer.bin"};
+
+class FileProducerTest : public TestBase {
+protected:
+  void TearDown() override { deleteFile(ProducerFile); }
+
+  /// messages of 1 to Count bytes with increasing values
+  std::vector<std::vector<uint8_t>> makeMessages(size_t Count) {
+    std::vector<std::vector<uint8_t>> Messages;
+    for (size_t i = 0; i < Count; i++) {
+      Messages.emplace_back(i + 1);
+      std::iota(Messages.back().begin(), Messages.back().end(), uint8_t(i));
+    }
+    return Messages;
+  }
+
+  std::vector<std::vector<uint8_t>> replay() {
+    std::vector<std::vector<uint8_t>> Messages;
+    FileProducer::replay(ProducerFile, [&](nonstd::span<const uint8_t> Data) {
+      EXPECT_EQ(reinterpret_cast<uintptr_t>(Data.data()) % 8, 0);
+      Messages.emplace_back(Data.begin(), Data.end());
+    });
+    return Messages;
+  }
+
+  size_t fileSize() {
+    std::ifstream File(ProducerFile, std::ios::binary | std::ios::ate);
+    return File.tellg();
+  }
+};
+
+TEST_F(FileProducerTest, NullProducerCounts) {
+  NullProducer Producer;
+  std::vector<uint8_t> Data(100);
+  ASSERT_EQ(Producer.produce(Data, 0), 0);
+  ASSERT_EQ(Producer.produce({Data.data(), 10}, 0), 0);
+  ASSERT_EQ(Producer.Messages, 2);
+  ASSERT_EQ(Producer.Bytes, 110);
+}
+
+TEST_F(FileProducerTest, EmptyFile) {
+  { FileProducer Producer(ProducerFile); }
+  ASSERT_EQ(fileSize(), 0);
+  ASSERT_TRUE(replay().empty());
+}
+
+TEST_F(FileProducerTest, OpenFails) {
+  ASSERT_THROW(FileProducer("/this/does/not/exist/deleteme.bin"),
+               std::runtime_error);
+  ASSERT_THROW(FileProducer::replay("/this/does/not/exist/deleteme.bin",
+                                    [](nonstd::span<const uint8_t>) {}),
+               std::runtime_error);
+}
+
+TEST_F(FileProducerTest, WriteAndReplay) {
+  auto Messages = makeMessages(20);
+  {
+    FileProducer Producer(ProducerFile);
+    for (auto &Message : Messages) {
+      ASSERT_EQ(Producer.produce(Message, 0), 0);
+    }
+    ASSERT_EQ(Producer.Messages, 20);
+    ASSERT_EQ(Producer.Bytes, 210);
+  }
+
+  // 8 byte size prefix and padding to 8 bytes
+  size_t Expected{0};
+  for (auto &Message : Messages) {
+    Expected += (8 + Message.size() + 7) / 8 * 8;
+  }
+  ASSERT_EQ(fileSize(), Expected);
+  ASSERT_EQ(replay(), Messages);
+}
+
+TEST_F(FileProducerTest, EmptyMessageNotWritten) {
+  {
+    FileProducer Producer(ProducerFile);
+    ASSERT_EQ(Producer.produce({}, 0), -1);
+    ASSERT_EQ(Producer.Messages, 0);
+  }
+  ASSERT_EQ(fileSize(), 0);
+}
+
+TEST_F(FileProducerTest, WriteAcrossChunks) {
+  // chunks are one page, so most messages need a new mapping
+  auto Messages = makeMessages(3000);
+  {
+    FileProducer Producer(ProducerFile, 1);
+    for (auto &Message : Messages) {
+      ASSERT_EQ(Producer.produce(Message, 0), 0);
+    }
+  }
+  ASSERT_EQ(replay(), Messages);
+}
+
+TEST_F(FileProducerTest, TruncatedFile) {
+  auto Messages = makeMessages(10);
+  {
+    FileProducer Producer(ProducerFile);
+    for (auto &Message : Messages) {
+      Producer.produce(Message, 0);
+    }
+  }
+  std::vector<char> Content(fileSize() - 8);
+  std::ifstream(ProducerFile, std::ios::binary)
+      .read(Content.data(), Content.size());
+  saveBuffer(ProducerFile, Content.data(), Content.size());
+
+  // the incomplete last record is not replayed
+  Messages.pop_back();
+  ASSERT_EQ(replay(), Messages);
+}
+
+TEST_F(FileProducerTest, NotTruncatedFile) {
+  auto Messages = makeMessages(10);
+  FileProducer Producer(ProducerFile, 1);
+  for (auto &Message : Messages) {
+    Producer.produce(Message, 0);
+  }
+
+  // as after an unclean shutdown the file still has the size of the chunk,
+  // replay stops at the zero filled part after the last message
+  ASSERT_GT(fileSize(), 8 * Messages.size() + Producer.Bytes);
+  ASSERT_EQ(replay(), Messages);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -7,9 +7,11 @@
 
 #include "KafkaMocks.h"
 #include <common/Statistics.h>
+#include <common/kafka/FileProducer.h>
 #include <common/kafka/KafkaConfig.h>
 #include <common/kafka/Producer.h>
 #include <common/math/Units.h>
+#include <common/testutils/SaveBuffer.h>
 #include <common/testutils/TestBase.h>
 #include <cstring>
 #include <dlfcn.h>
@@ -288,6 +290,8 @@ TEST_F(ProducerTest, DeliveryReportCbProcessesErrorsAndLogs) {
   Mock<RdKafka::Message> fakeMessage;
   When(Method(fakeMessage, status))
       .AlwaysReturn(RdKafka::Message::MSG_STATUS_NOT_PERSISTED);
+  When(Method(fakeMessage, latency)).AlwaysReturn(-1);
+  When(Method(fakeMessage, msg_opaque)).AlwaysReturn(nullptr);
 
   ON_CALL(LoggerMock, log(::testing::_, ::testing::_))
       .WillByDefault(
@@ -437,6 +441,8 @@ TEST_F(ProducerTest, BytesInQueueAndTxBytesUpdateCorrectly) {
   When(Method(fakeMessage, err)).AlwaysReturn(RdKafka::ERR_NO_ERROR);
   When(Method(fakeMessage, status))
       .AlwaysReturn(RdKafka::Message::MSG_STATUS_PERSISTED);
+  When(Method(fakeMessage, latency)).AlwaysReturn(-1);
+  When(Method(fakeMessage, msg_opaque)).AlwaysReturn(nullptr);
 
   prod.dr_cb(fakeMessage.get());
 
@@ -445,6 +451,175 @@ TEST_F(ProducerTest, BytesInQueueAndTxBytesUpdateCorrectly) {
   EXPECT_EQ(prod.getStats().BytesTransmittedToBrokers, DataSize);
 }
 
+struct CountingRelease : public ProducerBufferRelease {
+  void release() override { Releases++; }
+  int Releases{0};
+};
+
+TEST_F(ProducerTest, ZeroCopyReleasedOnDeliveryReport) {
+  Statistics Stats;
+  ProducerStandIn prod{"nobroker", "notopic", Stats};
+  CountingRelease Release;
+
+  auto MockKafkaProducer = new MockProducer();
+  EXPECT_CALL(*MockKafkaProducer,
+              produce(_, _, 0, _, _, _, _, _, &Release))
+      .Times(1)
+      .WillRepeatedly(testing::Return(RdKafka::ERR_NO_ERROR));
+  EXPECT_CALL(*MockKafkaProducer, poll(_))
+      .Times(1)
+      .WillRepeatedly(testing::Return(0));
+  EXPECT_CALL(*MockKafkaProducer, outq_len())
+      .WillRepeatedly(testing::Return(0));
+  prod.KafkaProducer.reset(MockKafkaProducer);
+
+  std::vector<unsigned char> DataBuffer(100);
+  ASSERT_EQ(prod.produceZeroCopy(DataBuffer, 0, Release), 0);
+  EXPECT_EQ(prod.getStats().ProduceBytesOk, 100);
+  EXPECT_EQ(Release.Releases, 0);
+
+  Mock<RdKafka::Message> fakeMessage;
+  When(Method(fakeMessage, len)).AlwaysReturn(100);
+  When(Method(fakeMessage, err)).AlwaysReturn(RdKafka::ERR_NO_ERROR);
+  When(Method(fakeMessage, status))
+      .AlwaysReturn(RdKafka::Message::MSG_STATUS_PERSISTED);
+  When(Method(fakeMessage, latency)).AlwaysReturn(-1);
+  When(Method(fakeMessage, msg_opaque))
+      .AlwaysReturn(static_cast<void *>(&Release));
+
+  prod.dr_cb(fakeMessage.get());
+  EXPECT_EQ(Release.Releases, 1);
+}
+
+TEST_F(ProducerTest, ThreadProducesQueuedBuffers) {
+  Statistics Stats;
+  ProducerStandIn prod{"nobroker", "notopic", Stats};
+  CountingRelease Release;
+
+  // the copy made by produce() is queued last
+  void *CopyOpaque{nullptr};
+  auto MockKafkaProducer = new MockProducer();
+  EXPECT_CALL(*MockKafkaProducer, produce(_, _, 0, _, _, _, _, _, _))
+      .Times(2)
+      .WillRepeatedly(testing::DoAll(testing::SaveArg<8>(&CopyOpaque),
+                                     testing::Return(RdKafka::ERR_NO_ERROR)));
+  EXPECT_CALL(*MockKafkaProducer, poll(_))
+      .WillRepeatedly(testing::Return(0));
+  EXPECT_CALL(*MockKafkaProducer, outq_len())
+      .WillRepeatedly(testing::Return(0));
+  prod.KafkaProducer.reset(MockKafkaProducer);
+
+  prod.startThread();
+  std::vector<unsigned char> DataBuffer(100);
+  ASSERT_EQ(prod.produceZeroCopy(DataBuffer, 0, Release), 0);
+  ASSERT_EQ(prod.produce(DataBuffer, 0), 0);
+  prod.stopThread();
+
+  EXPECT_EQ(prod.getStats().ProduceCalls, 2);
+  EXPECT_EQ(prod.getStats().ProduceBytesOk, 200);
+  EXPECT_EQ(prod.getStats().HandoffQueueFull, 0);
+  EXPECT_EQ(Release.Releases, 0);
+
+  Mock<RdKafka::Message> fakeMessage;
+  When(Method(fakeMessage, len)).AlwaysReturn(100);
+  When(Method(fakeMessage, err)).AlwaysReturn(RdKafka::ERR_NO_ERROR);
+  When(Method(fakeMessage, status))
+      .AlwaysReturn(RdKafka::Message::MSG_STATUS_PERSISTED);
+  When(Method(fakeMessage, latency)).AlwaysReturn(250);
+  When(Method(fakeMessage, msg_opaque))
+      .AlwaysReturn(static_cast<void *>(&Release));
+
+  prod.dr_cb(fakeMessage.get());
+  EXPECT_EQ(Release.Releases, 1);
+  EXPECT_EQ(prod.getStats().DeliveryLatencyUsTotal, 250);
+
+  // frees the copy
+  ASSERT_NE(CopyOpaque, nullptr);
+  When(Method(fakeMessage, msg_opaque)).AlwaysReturn(CopyOpaque);
+  prod.dr_cb(fakeMessage.get());
+  EXPECT_EQ(Release.Releases, 1);
+  EXPECT_EQ(prod.getStats().DeliveryLatencyUsTotal, 500);
+}
+
+TEST_F(ProducerTest, ZeroCopyReleasedOnProduceError) {
+  Statistics Stats;
+  ProducerStandIn prod{"nobroker", "notopic", Stats};
+  CountingRelease Release;
+
+  auto MockKafkaProducer = new MockProducer();
+  EXPECT_CALL(*MockKafkaProducer, produce(_, _, _, _, _, _, _, _, _))
+      .Times(1)
+      .WillRepeatedly(testing::Return(RdKafka::ERR__QUEUE_FULL));
+  EXPECT_CALL(*MockKafkaProducer, poll(_))
+      .Times(1)
+      .WillRepeatedly(testing::Return(0));
+  prod.KafkaProducer.reset(MockKafkaProducer);
+
+  uint8_t SomeData[20];
+  ASSERT_EQ(prod.produceZeroCopy(SomeData, 0, Release),
+            RdKafka::ERR__QUEUE_FULL);
+  EXPECT_EQ(prod.getStats().ErrQueueFull, 1);
+  EXPECT_EQ(Release.Releases, 1);
+
+  // no producer, released immediately as well
+  prod.KafkaProducer.reset(nullptr);
+  ASSERT_EQ(prod.produceZeroCopy(SomeData, 0, Release), RdKafka::ERR_UNKNOWN);
+  EXPECT_EQ(Release.Releases, 2);
+}
+
+TEST_F(ProducerTest, NullBroker) {
+  Statistics Stats;
+  ProducerStandIn prod{"null://", "notopic", Stats};
+  ASSERT_EQ(prod.KafkaProducer, nullptr);
+
+  CountingRelease Release;
+  std::vector<unsigned char> DataBuffer(100);
+  ASSERT_EQ(prod.produce(DataBuffer, 0), 0);
+  ASSERT_EQ(prod.produceZeroCopy(DataBuffer, 0, Release), 0);
+  prod.poll(0);
+
+  EXPECT_EQ(Release.Releases, 1);
+  EXPECT_EQ(prod.getStats().ProduceCalls, 2);
+  EXPECT_EQ(prod.getStats().ProduceBytesOk, 200);
+  EXPECT_EQ(prod.getStats().MsgDeliverySuccess, 2);
+  EXPECT_EQ(prod.getStats().MsgStatusPersisted, 2);
+  EXPECT_EQ(prod.getStats().BytesInQueue, 0);
+}
+
+TEST_F(ProducerTest, FileBrokerWithThread) {
+  std::string Topic{"deleteme_producer_topic"};
+  std::vector<unsigned char> DataBuffer(100, 0xaa);
+  {
+    Statistics Stats;
+    Producer prod{"file://.", Topic, KafkaCfg.CfgParms, Stats, "file"};
+    prod.startThread();
+    for (int i = 0; i < 10; i++) {
+      ASSERT_EQ(prod.produce(DataBuffer, 0), 0);
+    }
+    prod.stopThread();
+    EXPECT_EQ(prod.getStats().ProduceBytesOk, 1000);
+    EXPECT_EQ(prod.getStats().MsgStatusPersisted, 10);
+  }
+
+  size_t Messages = FileProducer::replay(
+      "./" + Topic + ".bin", [&](nonstd::span<const uint8_t> Data) {
+        EXPECT_TRUE(std::equal(Data.begin(), Data.end(), DataBuffer.begin(),
+                               DataBuffer.end()));
+      });
+  EXPECT_EQ(Messages, 10);
+  deleteFile(Topic + ".bin");
+}
+
+TEST_F(ProducerTest, FileBrokerOpenFails) {
+  Statistics Stats;
+  Producer prod{"file:///this/does/not/exist", "deleteme_producer_topic",
+                KafkaCfg.CfgParms, Stats, "file"};
+  EXPECT_EQ(prod.getStats().ErrConfig, 1);
+
+  std::vector<unsigned char> DataBuffer(100);
+  EXPECT_NE(prod.produce(DataBuffer, 0), 0);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,101 @@
+// Copyright (C) 2026 European Spallation Source, see LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Flat table to access data through a 2D indexing as key
+///
+/// Drop-in replacement for HashMap2D for small, bounded indexes such as
+/// FEN and Channel. Values are found by a bounds check and a single load,
+/// missing values are returned as nullptr rather than by exceptions.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+/// \class A class template representing a 2D (column, row) table of values.
+///
+/// Values are stored at index Row * NumColumns + Col of a vector which grows
+/// to the largest index added, so the indexes must be small non negative
+/// numbers. Unlike HashMap2D, Col must be less than NumColumns, so that
+/// different (Col, Row) pairs never share an index.
+///
+/// \tparam T The type of the values to be stored.
+template <typename T> class DenseMap2D {
+public:
+  /// Constructor to initialize the number of columns.
+  DenseMap2D(int NumColumns) : NumColumns(NumColumns) {}
+
+  /// Adds a value to the table.
+  ///
+  /// This function adds a value to the table based on the given Column
+  /// and Row index. The value is moved into the table, so the original
+  /// object is no longer valid after this function is called. If the
+  /// table already has a value at Column and Row, it is kept and Value is
+  /// not moved.
+  ///
+  /// \param Col The Column index.
+  /// \param Row The Row index.
+  /// \param Value The value to be added (the pointer is dereferenced and
+  /// moved).
+  /// \throws std::out_of_range if Col is not in [0, NumColumns) or Row is
+  /// negative.
+  inline void add(int Col, int Row, std::unique_ptr<T> &Value) {
+    if (Col < 0 or Col >= NumColumns or Row < 0) {
+      throw std::out_of_range("DenseMap2D Col or Row out of range");
+    }
+    size_t Index = static_cast<size_t>(Row) * NumColumns + Col;
+    if (Index >= Values.size()) {
+      Values.resize(Index + 1);
+    }
+    if (Values[Index]) {
+      return;
+    }
+    Values[Index] = std::move(Value);
+    ValueList.push_back(Values[Index].get());
+  }
+
+  /// Retrieves a value from the table.
+  ///
+  /// \param Col The Column index.
+  /// \param Row The Row index.
+  /// \return A pointer to the value, or nullptr if the table has no value
+  /// at Column and Row.
+  inline T *get(int Col, int Row) const {
+    if (static_cast<unsigned>(Col) >= static_cast<unsigned>(NumColumns)) {
+      return nullptr;
+    }
+    size_t Index = static_cast<unsigned>(Row) * size_t(NumColumns) + Col;
+    if (Index >= Values.size()) {
+      return nullptr;
+    }
+    return Values[Index].get();
+  }
+
+  /// Checks if a value exists in the table.
+  ///
+  /// \param Col The Column index.
+  /// \param Row The Row index.
+  /// \return True if the value exists, false otherwise.
+  inline bool isValue(int Col, int Row) const {
+    return get(Col, Row) != nullptr;
+  }
+
+  /// Retrieves all the values in the table, in the order they were added.
+  ///
+  /// \return A reference to the list of values.
+  const std::vector<T *> &toValuesList() const { return ValueList; }
+
+  /// Checks if the table is empty.
+  ///
+  /// \return True if the table is empty, false otherwise.
+  bool isEmpty() const { return ValueList.empty(); }
+
+private:
+  int NumColumns;
+  std::vector<std::unique_ptr<T>> Values{};
+  std::vector<T *> ValueList{};
+};
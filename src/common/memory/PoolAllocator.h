@@ -1,4 +1,4 @@
-// Copyright (C) 2020 - 2025 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2020 - 2026 European Spallation Source, ERIC. See LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -12,12 +12,16 @@
 #include <common/memory/FixedSizePool.h>
 
 #include <cstdint>
+#include <mutex>
 
 /// \class PoolAllocatorConfig
 /// \brief The class contains the compile-time parameters and configuration for
 ///        \class PoolAllocator. \class FixedSizePool is used for storage.
+///        With ThreadSafe the allocator serializes allocations and
+///        deallocations with a mutex, for pools shared between threads.
 template <class T_, size_t TotalBytes_, size_t ObjectsPerSlot_,
-          bool Validate_ = true, bool UseAsserts_ = true>
+          bool Validate_ = true, bool UseAsserts_ = true,
+          bool ThreadSafe_ = false>
 struct PoolAllocatorConfig {
   using T = T_;
   enum : size_t {
@@ -26,7 +30,8 @@ struct PoolAllocatorConfig {
     SlotBytes = sizeof(T) * ObjectsPerSlot,
     NumSlots = TotalBytes / SlotBytes,
     Validate = Validate_,
-    UseAsserts = UseAsserts_
+    UseAsserts = UseAsserts_,
+    ThreadSafe = ThreadSafe_
   };
 
   static_assert(TotalBytes >= SlotBytes,
@@ -61,11 +66,23 @@ template <typename PoolAllocatorConfigT> struct PoolAllocator {
         PoolAllocator<PoolAllocatorConfig<U, PoolAllocatorConfigT::TotalBytes,
                                           PoolAllocatorConfigT::ObjectsPerSlot,
                                           PoolAllocatorConfigT::Validate,
-                                          PoolAllocatorConfigT::UseAsserts>>;
+                                          PoolAllocatorConfigT::UseAsserts,
+                                          PoolAllocatorConfigT::ThreadSafe>>;
   };
 
   T *allocate(std::size_t numElements);
   void deallocate(T *p, std::size_t) noexcept;
+
+private:
+  /// \brief returns a lock on the mutex shared by all allocators with this
+  ///        config, which is not locked unless the config is ThreadSafe
+  static std::unique_lock<std::mutex> lockPool() {
+    static std::mutex PoolMutex;
+    if (PoolAllocatorConfigT::ThreadSafe) {
+      return std::unique_lock<std::mutex>(PoolMutex);
+    }
+    return std::unique_lock<std::mutex>(PoolMutex, std::defer_lock);
+  }
 };
 
 template <typename PoolAllocatorConfigT>
@@ -73,6 +90,7 @@ typename PoolAllocatorConfigT::T *
 PoolAllocator<PoolAllocatorConfigT>::allocate(std::size_t numElements) {
   size_t byteCount = sizeof(T) * numElements;
   T *alloc = nullptr;
+  auto Lock = lockPool();
   if (LIKELY(byteCount <= Pool.SlotBytes)) {
     alloc = (T *)Pool.AllocateSlot(byteCount);
   }
@@ -91,6 +109,7 @@ template <typename PoolAllocatorConfigT>
 void PoolAllocator<PoolAllocatorConfigT>::deallocate(T *p,
                                                      std::size_t) noexcept {
   if (LIKELY(Pool.Contains(p))) {
+    auto Lock = lockPool();
     Pool.DeallocateSlot(p);
   } else {
     std::free(p);
@@ -13,6 +13,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <vector>
 
 template <const unsigned int N> class RingBuffer {
   static const unsigned int COOKIE1 = 0xDEADC0DE;
@@ -47,6 +48,16 @@ public:
   /// \param length Size of data (Bytes)
   void setDataLength(unsigned int index, unsigned int length);
 
+  /// \brief Let the specified entry refer to data owned by someone else
+  /// (for example a memory mapped kernel receive ring) instead of its own
+  /// buffer. Used for zero copy receive, the caller must keep the data
+  /// valid until the consumer has finished with the entry.
+  /// \param index Index of the specified buffer
+  /// \param buffer Pointer to external data, nullptr reverts to own buffer
+  /// \param length Size of data (Bytes)
+  void setExternalBuffer(unsigned int index, char *buffer,
+                         unsigned int length);
+
   /// \brief get the length of data in specified  buffer
   /// \param index Index of specified buffer
   int getDataLength(const unsigned int index);
@@ -59,18 +70,25 @@ public:
   int getMaxBufSize() { return N; }             ///< return buffer size in bytes
   int getMaxElements() { return max_entries_; } ///< return number of buffers
 
+  /// \brief memory holding the buffers, for example for NUMA placement
+  void *getStorage() { return data; }
+  size_t getStorageSize() const { return sizeof(Data) * max_entries_; }
+
   bool verifyBufferCookies(unsigned int index) {
     return (data[index].cookie1 == COOKIE1 && data[index].cookie2 == COOKIE2);
   };
 
 private:
   struct Data *data{nullptr};
+  /// data owned elsewhere, see setExternalBuffer()
+  std::vector<char *> external_;
   unsigned int entry_{0};
   unsigned int max_entries_{0};
 };
 
 template <const unsigned int N>
-RingBuffer<N>::RingBuffer(int entries) : max_entries_(entries) {
+RingBuffer<N>::RingBuffer(int entries)
+    : external_(entries, nullptr), max_entries_(entries) {
   data = new Data[entries];
 }
 
@@ -88,6 +106,9 @@ char *RingBuffer<N>::getDataBuffer(unsigned int index) {
   assert(index < max_entries_);
   assert(data[index].cookie1 == COOKIE1);
   assert(data[index].cookie2 == COOKIE2);
+  if (external_[index] != nullptr) {
+    return external_[index];
+  }
   return data[index].buffer;
 }
 
@@ -104,6 +125,15 @@ void RingBuffer<N>::setDataLength(unsigned int index, unsigned int length) {
   data[index].length = length;
 }
 
+template <const unsigned int N>
+void RingBuffer<N>::setExternalBuffer(unsigned int index, char *buffer,
+                                      unsigned int length) {
+  assert(length <= N);
+  assert(index < max_entries_);
+  external_[index] = buffer;
+  data[index].length = length;
+}
+
 /// \todo using powers of two and bitmask in stead of modulus
 template <const unsigned int N> int RingBuffer<N>::getNextBuffer() {
   entry_ = (entry_ + 1) % max_entries_;
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 
@@ -41,6 +42,7 @@ public:
   bool wasEmpty() const;
   bool wasFull() const;
   int free() const;
+  size_t size() const;
   bool isLockFree() const;
 
 private:
@@ -110,6 +112,13 @@ int CircularFifo<Element, Size>::free() const {
   return free;
 }
 
+// snapshot of the number of queued elements. Only exact when called from the
+// producer or the consumer side, otherwise a (conservative) approximation
+template <typename Element, size_t Size>
+size_t CircularFifo<Element, Size>::size() const {
+  return (_tail.load() + Capacity - _head.load()) % Capacity;
+}
+
 template <typename Element, size_t Size>
 bool CircularFifo<Element, Size>::isLockFree() const {
   return (_tail.is_lock_free() && _head.is_lock_free());
@@ -122,3 +131,160 @@ size_t CircularFifo<Element, Size>::increment(size_t idx) const {
 }
 
 } // namespace memory_sequential_consistent
+
+/// \brief Variant of the circular fifo above with acquire/release ordering.
+///
+/// Producer (tail) and consumer (head) indices are kept on separate cache
+/// lines, each next to a cached copy of the other side's index. The other
+/// index is only reloaded when the cached copy says the queue is full
+/// (producer) or empty (consumer), which avoids most cross core cache line
+/// transfers. pushBulk() and popBulk() move several elements with a single
+/// index update.
+namespace memory_relaxed_acquire_release {
+template <typename Element, size_t Size> class CircularFifo {
+public:
+  enum { Capacity = Size + 1 };
+  static constexpr size_t CacheLineSize{64};
+
+  CircularFifo() = default;
+
+  bool push(const Element &item);
+  bool pop(Element &item);
+
+  /// \brief push up to count elements
+  /// \return number of elements pushed, can be less than count if full
+  size_t pushBulk(const Element *items, size_t count);
+
+  /// \brief pop up to count elements
+  /// \return number of elements popped, 0 if empty
+  size_t popBulk(Element *items, size_t count);
+
+  bool wasEmpty() const;
+  bool wasFull() const;
+  int free() const;
+  size_t size() const;
+  bool isLockFree() const;
+
+private:
+  size_t increment(size_t idx) const { return (idx + 1) % Capacity; }
+
+  /// producer side
+  alignas(CacheLineSize) std::atomic<size_t> _tail{0}; // tail(input) index
+  size_t _headCache{0}; // producer's last seen head
+
+  /// consumer side
+  alignas(CacheLineSize) std::atomic<size_t> _head{0}; // head(output) index
+  size_t _tailCache{0}; // consumer's last seen tail
+
+  alignas(CacheLineSize) Element _array[Capacity];
+};
+
+// Push on tail. Tail is only changed by the producer and can be loaded
+// relaxed, head is only reloaded (acquire) when the queue looks full
+template <typename Element, size_t Size>
+bool CircularFifo<Element, Size>::push(const Element &item) {
+  const auto current_tail = _tail.load(std::memory_order_relaxed);
+  const auto next_tail = increment(current_tail);
+  if (next_tail == _headCache) {
+    _headCache = _head.load(std::memory_order_acquire);
+    if (next_tail == _headCache) {
+      return false; // full queue
+    }
+  }
+  _array[current_tail] = item;
+  _tail.store(next_tail, std::memory_order_release);
+  return true;
+}
+
+// Pop by Consumer can only update the head, tail is only reloaded (acquire)
+// when the queue looks empty
+template <typename Element, size_t Size>
+bool CircularFifo<Element, Size>::pop(Element &item) {
+  const auto current_head = _head.load(std::memory_order_relaxed);
+  if (current_head == _tailCache) {
+    _tailCache = _tail.load(std::memory_order_acquire);
+    if (current_head == _tailCache) {
+      return false; // empty queue
+    }
+  }
+  item = _array[current_head];
+  _head.store(increment(current_head), std::memory_order_release);
+  return true;
+}
+
+template <typename Element, size_t Size>
+size_t CircularFifo<Element, Size>::pushBulk(const Element *items,
+                                             size_t count) {
+  const auto current_tail = _tail.load(std::memory_order_relaxed);
+  size_t available = (_headCache + Capacity - current_tail - 1) % Capacity;
+  if (available < count) {
+    _headCache = _head.load(std::memory_order_acquire);
+    available = (_headCache + Capacity - current_tail - 1) % Capacity;
+  }
+  const size_t n = std::min(count, available);
+  if (n == 0) {
+    return 0;
+  }
+
+  // copy in at most two parts, up to the end of the array and from the start
+  const size_t first = std::min(n, Capacity - current_tail);
+  std::copy(items, items + first, _array + current_tail);
+  std::copy(items + first, items + n, _array);
+  _tail.store((current_tail + n) % Capacity, std::memory_order_release);
+  return n;
+}
+
+template <typename Element, size_t Size>
+size_t CircularFifo<Element, Size>::popBulk(Element *items, size_t count) {
+  const auto current_head = _head.load(std::memory_order_relaxed);
+  size_t available = (_tailCache + Capacity - current_head) % Capacity;
+  if (available < count) {
+    _tailCache = _tail.load(std::memory_order_acquire);
+    available = (_tailCache + Capacity - current_head) % Capacity;
+  }
+  const size_t n = std::min(count, available);
+  if (n == 0) {
+    return 0;
+  }
+
+  const size_t first = std::min(n, Capacity - current_head);
+  std::copy(_array + current_head, _array + current_head + first, items);
+  std::copy(_array, _array + n - first, items + first);
+  _head.store((current_head + n) % Capacity, std::memory_order_release);
+  return n;
+}
+
+// snapshot with acceptance of that this comparison function is not atomic
+template <typename Element, size_t Size>
+bool CircularFifo<Element, Size>::wasEmpty() const {
+  return (_head.load(std::memory_order_acquire) ==
+          _tail.load(std::memory_order_acquire));
+}
+
+// snapshot with acceptance that this comparison is not atomic
+template <typename Element, size_t Size>
+bool CircularFifo<Element, Size>::wasFull() const {
+  const auto next_tail = increment(_tail.load(std::memory_order_acquire));
+  return (next_tail == _head.load(std::memory_order_acquire));
+}
+
+template <typename Element, size_t Size>
+int CircularFifo<Element, Size>::free() const {
+  return Size - size();
+}
+
+// snapshot of the number of queued elements. Only exact when called from the
+// producer or the consumer side, otherwise a (conservative) approximation
+template <typename Element, size_t Size>
+size_t CircularFifo<Element, Size>::size() const {
+  return (_tail.load(std::memory_order_acquire) + Capacity -
+          _head.load(std::memory_order_acquire)) %
+         Capacity;
+}
+
+template <typename Element, size_t Size>
+bool CircularFifo<Element, Size>::isLockFree() const {
+  return (_tail.is_lock_free() && _head.is_lock_free());
+}
+
+} // namespace memory_relaxed_acquire_release
@@ -0,0 +1,76 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Read only view of the validated readouts of a packet
+///
+/// Readout parsers can leave validated readouts where they are, in the
+/// receive buffer, instead of copying them into a vector. The view then
+/// either covers consecutive readouts, or selects readouts by index when
+/// invalid readouts have been skipped. The viewed memory must stay valid
+/// while the view is used.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace ess_readout {
+
+template <typename Readout> class ReadoutView {
+public:
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Readout;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Readout *;
+    using reference = const Readout &;
+
+    Iterator(const ReadoutView *View, size_t Pos) : View(View), Pos(Pos) {}
+
+    reference operator*() const { return (*View)[Pos]; }
+    pointer operator->() const { return &(*View)[Pos]; }
+
+    Iterator &operator++() {
+      Pos++;
+      return *this;
+    }
+
+    bool operator==(const Iterator &Other) const { return Pos == Other.Pos; }
+    bool operator!=(const Iterator &Other) const { return Pos != Other.Pos; }
+
+  private:
+    const ReadoutView *View;
+    size_t Pos;
+  };
+
+  ReadoutView() = default;
+
+  /// \brief view of Count consecutive readouts starting at Base
+  ReadoutView(const Readout *Base, size_t Count) : Base(Base), Count(Count) {}
+
+  /// \brief view of the readouts Base[Indices[0]] ... Base[Indices[Count-1]]
+  ReadoutView(const Readout *Base, const uint16_t *Indices, size_t Count)
+      : Base(Base), Indices(Indices), Count(Count) {}
+
+  size_t size() const { return Count; }
+  bool empty() const { return Count == 0; }
+
+  const Readout &operator[](size_t Pos) const {
+    return Indices == nullptr ? Base[Pos] : Base[Indices[Pos]];
+  }
+
+  Iterator begin() const { return Iterator(this, 0); }
+  Iterator end() const { return Iterator(this, Count); }
+
+private:
+  const Readout *Base{nullptr};
+  const uint16_t *Indices{nullptr}; ///< nullptr for consecutive readouts
+  size_t Count{0};
+};
+
+} // namespace ess_readout
@@ -26,6 +26,10 @@ int VMM3Parser::parse(ess_readout::Parser::PacketDataV0 &PacketData) {
   char *Buffer = (char *)PacketData.DataPtr;
   unsigned int Size = PacketData.DataLength;
 
+  InPlaceReadouts = (const VMM3Data *)Buffer;
+  InPlaceTotal = 0;
+  InPlaceIndices.clear();
+
   if (Buffer == nullptr) {
     Stats.ErrorSize++;
     XTRACE(DATA, WAR, "Invalid data pointer");
@@ -40,6 +44,7 @@ int VMM3Parser::parse(ess_readout::Parser::PacketDataV0 &PacketData) {
   }
 
   VMM3Parser::VMM3Data *DataPtr = (struct VMM3Data *)Buffer;
+  InPlaceTotal = Size / DataLength;
   for (unsigned int i = 0; i < Size / DataLength; i++) {
     Stats.Readouts++;
     VMM3Parser::VMM3Data Readout = DataPtr[i];
@@ -116,7 +121,11 @@ int VMM3Parser::parse(ess_readout::Parser::PacketDataV0 &PacketData) {
     }
 
     GoodReadouts++;
-    Result.push_back(Readout);
+    if (ParseInPlace) {
+      InPlaceIndices.push_back(i);
+    } else {
+      Result.push_back(Readout);
+    }
   }
 
   return GoodReadouts;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <common/readout/ess/Parser.h>
+#include <common/readout/ess/ReadoutView.h>
 #include <common/readout/vmm3/Readout.h>
 
 #include <cinttypes>
@@ -61,7 +62,10 @@ public:
   static_assert(sizeof(VMM3Parser::VMM3Data) == (VMM3DATASIZE),
                 "Wrong header size (update assert or check packing)");
 
-  VMM3Parser() { Result.reserve(MaxReadoutsInPacket); };
+  VMM3Parser() {
+    Result.reserve(MaxReadoutsInPacket);
+    InPlaceIndices.reserve(MaxReadoutsInPacket);
+  };
 
   /// \brief VMM readout is used as monitor
   /// this mainly affects parsing of the ADC field which
@@ -74,6 +78,21 @@ public:
   //
   int parse(ess_readout::Parser::PacketDataV0 &PacketData);
 
+  /// \brief don't copy readouts into Result, readouts() then refers to the
+  /// packet data, which must stay valid until the readouts are processed
+  void setInPlace(bool InPlace) { ParseInPlace = InPlace; }
+
+  /// \brief readouts of the last parse(), in place or in Result
+  ess_readout::ReadoutView<VMM3Data> readouts() const {
+    if (not ParseInPlace) {
+      return {Result.data(), Result.size()};
+    }
+    if (InPlaceIndices.size() == InPlaceTotal) { // no invalid readouts
+      return {InPlaceReadouts, InPlaceTotal};
+    }
+    return {InPlaceReadouts, InPlaceIndices.data(), InPlaceIndices.size()};
+  }
+
   // To be iterated over in processing thread
   std::vector<struct VMM3Data> Result;
 
@@ -88,5 +107,10 @@ private:
   const uint16_t OverThresholdMask{0x8000};
   const uint16_t ADCMask{0x7fff};
   bool IsMonitor{false};
+
+  bool ParseInPlace{false};
+  const VMM3Data *InPlaceReadouts{nullptr};
+  size_t InPlaceTotal{0}; ///< valid and invalid readouts in the packet
+  std::vector<uint16_t> InPlaceIndices; ///< indices of valid readouts
 };
 } // namespace vmm3
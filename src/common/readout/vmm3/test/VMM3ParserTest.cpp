@@ -76,6 +76,34 @@ TEST_F(VMM3ParserTest, ErrorFEN) {
   ASSERT_EQ(VMMParser.Stats.ErrorFEN, 1);
 }
 
+// Invalid first readout is skipped, readouts are selected by index
+TEST_F(VMM3ParserTest, ErrorFENInPlace) {
+  makeHeader(VMMFENError);
+  VMMParser.setInPlace(true);
+  auto Res = VMMParser.parse(PacketData);
+  ASSERT_EQ(Res, 1);
+  ASSERT_EQ(VMMParser.Result.size(), 0);
+  ASSERT_EQ(VMMParser.readouts().size(), 1);
+  EXPECT_EQ((char *)&VMMParser.readouts()[0], (char *)&VMMFENError[20]);
+}
+
+// All readouts valid, readouts are viewed consecutively
+TEST_F(VMM3ParserTest, DataInPlace) {
+  makeHeader(VMMData1);
+  VMMParser.setInPlace(true);
+  auto Res = VMMParser.parse(PacketData);
+  ASSERT_EQ(Res, 2);
+  ASSERT_EQ(VMMParser.Result.size(), 0);
+
+  int Count{0};
+  for (auto &Readout : VMMParser.readouts()) {
+    EXPECT_EQ((char *)&Readout, (char *)&VMMData1[Count * 20]);
+    EXPECT_EQ(Readout.FiberId, Count + 1);
+    Count++;
+  }
+  EXPECT_EQ(Count, 2);
+}
+
 // Invalid data length - so far always 20 bytes.
 TEST_F(VMM3ParserTest, ErrorDataLength) {
   makeHeader(VMMDataLengthError);
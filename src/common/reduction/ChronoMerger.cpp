@@ -2,7 +2,7 @@
 
 //===----------------------------------------------------------------------===//
 ///
-/// \file ChronoMerger.h
+/// \file ChronoMerger.cpp
 /// \brief ChronoMerger class implementation
 ///
 //===----------------------------------------------------------------------===//
@@ -18,18 +18,32 @@
 ChronoMerger::ChronoMerger(uint64_t maximum_latency, size_t modules)
     : maximum_latency_(maximum_latency) {
   latest_.resize(modules, 0);
+  queues_.resize(modules);
+  heap_.reserve(modules);
+  heap_index_.resize(modules, NotInHeap);
 }
 
 void ChronoMerger::insert(size_t module, NeutronEvent event) {
   latest_[module] = std::max(event.time, latest_.at(module));
-  queue_.push_back(event);
+
+  auto &queue = queues_[module];
+  bool was_empty = queue.empty();
+  uint64_t old_earliest = was_empty ? 0 : queue.front().time;
+  queue.insert(event);
+  size_++;
+
+  if (was_empty) {
+    heap_push(module);
+  } else if (event.time < old_earliest) {
+    heap_sift_up(heap_index_[module]);
+  }
 }
 
 void ChronoMerger::insert(size_t module, std::list<NeutronEvent> &events) {
   for (const auto &event : events) {
-    latest_[module] = std::max(event.time, latest_.at(module));
+    insert(module, event);
   }
-  queue_.splice(queue_.end(), events);
+  events.clear();
 }
 
 void ChronoMerger::sync_up(size_t module1, size_t module2) {
@@ -37,17 +51,13 @@ void ChronoMerger::sync_up(size_t module1, size_t module2) {
       std::max(latest_[module1], latest_[module2]);
 }
 
-void ChronoMerger::sort() {
-  queue_.sort([](const NeutronEvent &e1, const NeutronEvent &e2) {
-    return e1.time < e2.time;
-  });
-}
-
 void ChronoMerger::reset() { latest_.assign(latest_.size(), 0); }
 
-bool ChronoMerger::empty() const { return queue_.empty(); }
+bool ChronoMerger::empty() const { return size_ == 0; }
 
-uint64_t ChronoMerger::earliest() const { return queue_.front().time; }
+uint64_t ChronoMerger::earliest() const {
+  return queues_[heap_.front()].front().time;
+}
 
 uint64_t ChronoMerger::horizon() const {
   uint64_t ret = std::numeric_limits<uint64_t>::max();
@@ -59,8 +69,23 @@ uint64_t ChronoMerger::horizon() const {
 }
 
 NeutronEvent ChronoMerger::pop_earliest() {
-  auto ret = queue_.front();
-  queue_.pop_front();
+  uint32_t module = heap_.front();
+  auto &queue = queues_[module];
+  auto ret = queue.front();
+  queue.pop_front();
+  size_--;
+
+  if (queue.empty()) {
+    heap_index_[module] = NotInHeap;
+    uint32_t last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+      heap_set(0, last);
+      heap_sift_down(0);
+    }
+  } else {
+    heap_sift_down(0);
+  }
   return ret;
 }
 
@@ -81,11 +106,85 @@ std::string ChronoMerger::debug(const std::string &prepend,
   for (size_t i = 0; i < latest_.size(); ++i) {
     ss << prepend << "  [" << i << "]  " << latest_[i] << "\n";
   }
-  if (verbose && !queue_.empty()) {
+  if (verbose && !empty()) {
     ss << prepend << "Queue:\n";
-    for (const auto &e : queue_) {
-      ss << prepend << "  " << e.to_string() << "\n";
+    for (size_t i = 0; i < queues_.size(); ++i) {
+      for (size_t j = 0; j < queues_[i].size(); ++j) {
+        ss << prepend << "  [" << i << "]  " << queues_[i][j].to_string()
+           << "\n";
+      }
     }
   }
   return ss.str();
 }
+
+bool ChronoMerger::heap_less(uint32_t module1, uint32_t module2) const {
+  uint64_t time1 = queues_[module1].front().time;
+  uint64_t time2 = queues_[module2].front().time;
+  return (time1 < time2) || (time1 == time2 && module1 < module2);
+}
+
+void ChronoMerger::heap_set(size_t index, uint32_t module) {
+  heap_[index] = module;
+  heap_index_[module] = index;
+}
+
+void ChronoMerger::heap_push(uint32_t module) {
+  heap_.push_back(module);
+  heap_index_[module] = heap_.size() - 1;
+  heap_sift_up(heap_.size() - 1);
+}
+
+void ChronoMerger::heap_sift_up(size_t index) {
+  uint32_t module = heap_[index];
+  while (index > 0) {
+    size_t parent = (index - 1) / 2;
+    if (!heap_less(module, heap_[parent]))
+      break;
+    heap_set(index, heap_[parent]);
+    index = parent;
+  }
+  heap_set(index, module);
+}
+
+void ChronoMerger::heap_sift_down(size_t index) {
+  uint32_t module = heap_[index];
+  size_t count = heap_.size();
+  while (true) {
+    size_t child = 2 * index + 1;
+    if (child >= count)
+      break;
+    if (child + 1 < count && heap_less(heap_[child + 1], heap_[child]))
+      child++;
+    if (!heap_less(heap_[child], module))
+      break;
+    heap_set(index, heap_[child]);
+    index = child;
+  }
+  heap_set(index, module);
+}
+
+void ChronoMerger::ModuleQueue::insert(const NeutronEvent &event) {
+  if (count_ == buffer_.size()) {
+    grow();
+  }
+  size_t mask = buffer_.size() - 1;
+
+  // walk back from the tail past later events, usually not at all
+  size_t position = count_;
+  while (position > 0 && (*this)[position - 1].time > event.time) {
+    buffer_[(head_ + position) & mask] = (*this)[position - 1];
+    position--;
+  }
+  buffer_[(head_ + position) & mask] = event;
+  count_++;
+}
+
+void ChronoMerger::ModuleQueue::grow() {
+  std::vector<NeutronEvent> buffer(buffer_.empty() ? 64 : 2 * buffer_.size());
+  for (size_t i = 0; i < count_; i++) {
+    buffer[i] = (*this)[i];
+  }
+  buffer_.swap(buffer);
+  head_ = 0;
+}
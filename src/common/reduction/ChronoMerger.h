@@ -12,6 +12,7 @@
 #include <common/reduction/NeutronEvent.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <vector>
 
@@ -20,9 +21,14 @@
 ///        semi-synchronized sources or processing pipelines. The queue
 ///        uses the criterion of maximum latency to guarantee that all
 ///        antecedent events from every pipeline have been collected before
-///        data is released. If sort is called judiciously, this can
-///        guarantee that data always comes out of the queue in chronological
-///        order.
+///        data is released, so events always come out of the queue in
+///        chronological order.
+///
+/// Each pipeline has its own ring buffer, kept in time order on insertion,
+/// which is cheap as events of one pipeline are mostly in order already.
+/// A min-heap over the earliest event of each pipeline gives a k-way merge,
+/// so popping an event is O(log k) for k pipelines instead of sorting all
+/// queued events.
 
 class ChronoMerger {
 public:
@@ -61,11 +67,9 @@ public:
   /// \param module2 id of second pipeline
   void sync_up(size_t module1, size_t module2);
 
-  /// \brief Sorts the queue chronologically. This should be performed at some
-  /// point
-  ///        after inserting some data and before attempting to pop any off the
-  ///        queue.
-  void sort();
+  /// \brief Kept for compatibility, the queue is always in chronological
+  ///        order.
+  void sort() {}
 
   /// \brief Resets the time horizons to 0. This can be done after flushing if
   ///        pipeline are to be restarted with a new clock.
@@ -74,8 +78,11 @@ public:
   /// \returns true if queue is empty
   bool empty() const;
 
+  /// \returns number of events in queue
+  size_t size() const { return size_; }
+
   /// \returns timestamp of earliest event in queue
-  /// \pre queue must have been sorted for this to be correct
+  /// \pre queue must not be empty
   uint64_t earliest() const;
 
   /// \returns the global time horizon for all tracked pipelines. The horizon
@@ -89,11 +96,10 @@ public:
   /// outside
   ///          the maximum latency window in relation to the global time
   ///          horizon.
-  /// \pre queue must have been sorted for this evaluation to be correct
   bool ready() const;
 
   /// \returns the earliest event in queue.
-  /// \pre queue must have been sorted prior to calling this
+  /// \pre queue must not be empty
   /// \post earliest event will be removed from queue
   NeutronEvent pop_earliest();
 
@@ -101,10 +107,53 @@ public:
   std::string debug(const std::string &prepend, bool verbose) const;
 
 private:
-  /// Queue of neutron events
-  std::list<NeutronEvent> queue_;
-
-  /// Queue of neutron events
+  /// \brief Growable ring buffer of the events of one pipeline, in time order
+  class ModuleQueue {
+  public:
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+    const NeutronEvent &front() const { return buffer_[head_]; }
+    const NeutronEvent &operator[](size_t i) const {
+      return buffer_[(head_ + i) & (buffer_.size() - 1)];
+    }
+    void pop_front() {
+      head_ = (head_ + 1) & (buffer_.size() - 1);
+      count_--;
+    }
+
+    /// \brief inserts event after all events which are not later, O(1) for
+    ///        events arriving in time order
+    void insert(const NeutronEvent &event);
+
+  private:
+    void grow();
+
+    std::vector<NeutronEvent> buffer_; ///< size is zero or a power of two
+    size_t head_{0};
+    size_t count_{0};
+  };
+
+  /// \brief min-heap order of pipelines, by earliest event then by index
+  bool heap_less(uint32_t module1, uint32_t module2) const;
+  void heap_push(uint32_t module);
+  void heap_sift_up(size_t index);
+  void heap_sift_down(size_t index);
+  void heap_set(size_t index, uint32_t module);
+
+  /// Queue of neutron events of each pipeline
+  std::vector<ModuleQueue> queues_;
+
+  /// Pipelines with queued events, the root has the earliest event
+  std::vector<uint32_t> heap_;
+
+  /// Position of each pipeline in heap_, or NotInHeap
+  std::vector<size_t> heap_index_;
+  static constexpr size_t NotInHeap{static_cast<size_t>(-1)};
+
+  /// Total number of queued events
+  size_t size_{0};
+
+  /// Latest event time seen from each pipeline
   std::vector<uint64_t> latest_;
 
   uint64_t maximum_latency_;
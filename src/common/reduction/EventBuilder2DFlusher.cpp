@@ -0,0 +1,79 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Flushes only the EventBuilder2D instances which received hits
+///
+//===----------------------------------------------------------------------===//
+
+#include <common/debug/Trace.h>
+#include <common/reduction/EventBuilder2DFlusher.h>
+
+#include <chrono>
+
+// #undef TRC_LEVEL
+// #define TRC_LEVEL TRC_L_DEB
+
+EventBuilder2DFlusher::EventBuilder2DFlusher(size_t Builders,
+                                             uint64_t FlushDelayNS)
+    : FlushDelayNS(FlushDelayNS), Touched(Builders, false),
+      Pending(Builders, false), PendingSinceNS(Builders, 0) {
+  TouchedBuilders.reserve(Builders);
+  FlushedBuilders.reserve(Builders);
+  PendingBuilders.reserve(Builders);
+}
+
+void EventBuilder2DFlusher::flush(std::vector<EventBuilder2D> &Builders,
+                                  bool FullFlush) {
+  uint64_t NowNS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+  flush(Builders, FullFlush, NowNS);
+}
+
+void EventBuilder2DFlusher::flush(std::vector<EventBuilder2D> &Builders,
+                                  bool FullFlush, uint64_t NowNS) {
+  FlushedBuilders.clear();
+
+  if (FlushDelayNS == 0) {
+    for (size_t Index : TouchedBuilders) {
+      Touched[Index] = false;
+      Builders[Index].flush(FullFlush);
+      FlushedBuilders.push_back(Index);
+    }
+  } else {
+    for (size_t Index : TouchedBuilders) {
+      Touched[Index] = false;
+      if (not Pending[Index]) {
+        Pending[Index] = true;
+        PendingSinceNS[Index] = NowNS;
+        PendingBuilders.push_back(Index);
+      }
+      if (NowNS - PendingSinceNS[Index] < FlushDelayNS) {
+        Builders[Index].flush(false);
+        FlushedBuilders.push_back(Index);
+      }
+    }
+
+    // touched or not, builders waiting for the flush delay are fully flushed
+    size_t Waiting{0};
+    for (size_t Index : PendingBuilders) {
+      if (NowNS - PendingSinceNS[Index] < FlushDelayNS) {
+        PendingBuilders[Waiting++] = Index;
+        continue;
+      }
+      XTRACE(CLUSTER, DEB, "deferred full flush of builder %zu", Index);
+      Pending[Index] = false;
+      Builders[Index].flush(true);
+      FlushedBuilders.push_back(Index);
+      Stats.DeferredFullFlushes++;
+    }
+    PendingBuilders.resize(Waiting);
+  }
+  TouchedBuilders.clear();
+
+  Stats.Flushes++;
+  Stats.LastBuildersFlushed = FlushedBuilders.size();
+  Stats.BuildersFlushed += FlushedBuilders.size();
+}
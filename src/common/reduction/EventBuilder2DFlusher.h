@@ -0,0 +1,84 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Flushes only the EventBuilder2D instances which received hits
+///
+/// VMM3 instruments keep one EventBuilder2D per panel, hybrid or FEN and
+/// used to flush all of them after every packet, sorting, clustering and
+/// matching also for builders without new hits. The instruments now mark
+/// the builders they insert hits into and only those are flushed.
+///
+/// With a flush delay, the builders are only partially flushed per packet,
+/// so clusters can span packet boundaries. A builder is fully flushed once
+/// its oldest hits have waited for the flush delay, which bounds the added
+/// latency. The processing threads also call flush() while idle if builders
+/// are pending, so the bound holds when the data stream pauses.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <common/reduction/EventBuilder2D.h>
+
+#include <cstdint>
+#include <vector>
+
+struct EventBuilder2DFlusherStats {
+  int64_t Flushes{0};             ///< calls to flush()
+  int64_t BuildersFlushed{0};     ///< builders flushed, summed over packets
+  int64_t LastBuildersFlushed{0}; ///< builders flushed in the last packet
+  int64_t DeferredFullFlushes{0}; ///< full flushes after the flush delay
+};
+
+class EventBuilder2DFlusher {
+public:
+  EventBuilder2DFlusher() = default;
+
+  /// \param Builders number of builders, indices passed to touch() must be
+  ///        below this
+  /// \param FlushDelayNS 0 flushes every touched builder as requested in
+  ///        flush(), otherwise touched builders are partially flushed and
+  ///        fully flushed after this delay
+  EventBuilder2DFlusher(size_t Builders, uint64_t FlushDelayNS);
+
+  /// \brief mark builder Index as having received hits
+  void touch(size_t Index) {
+    if (not Touched[Index]) {
+      Touched[Index] = true;
+      TouchedBuilders.push_back(Index);
+    }
+  }
+
+  /// \brief flush the builders touched since the last call, and with a
+  ///        flush delay, fully flush those waiting longer than the delay
+  /// \param FullFlush passed on to EventBuilder2D::flush() without a flush
+  ///        delay
+  void flush(std::vector<EventBuilder2D> &Builders, bool FullFlush);
+
+  /// \brief as above, with the current steady clock time in ns
+  void flush(std::vector<EventBuilder2D> &Builders, bool FullFlush,
+             uint64_t NowNS);
+
+  /// \brief indices of the builders flushed by the last flush() call, the
+  ///        only ones which can have new events
+  const std::vector<size_t> &flushed() const { return FlushedBuilders; }
+
+  /// \brief true if partially flushed builders wait for a full flush, which
+  ///        flush() does once the flush delay has passed, also untouched
+  bool pending() const { return not PendingBuilders.empty(); }
+
+  struct EventBuilder2DFlusherStats Stats;
+
+private:
+  uint64_t FlushDelayNS{0};
+
+  std::vector<bool> Touched;
+  std::vector<size_t> TouchedBuilders;
+  std::vector<size_t> FlushedBuilders;
+
+  /// builders partially flushed, waiting for a full flush
+  std::vector<bool> Pending;
+  std::vector<uint64_t> PendingSinceNS;
+  std::vector<size_t> PendingBuilders;
+};
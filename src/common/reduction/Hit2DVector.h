@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. See LICENSE file
 ///===--------------------------------------------------------------------===///
 ///
 /// \file Hit2DVector.h
@@ -12,6 +12,7 @@
 #include <common/memory/PoolAllocator.h>
 #include <common/math/Units.h>
 #include <common/reduction/Hit2D.h>
+#include <common/reduction/RadixSort.h>
 
 #include <filesystem>
 #include <sstream>
@@ -148,9 +149,10 @@ public:
 //-----------------------------------------------------------------------------
 
 struct Hit2DVectorStorage {
+  // thread safe as the timepix3 sub frames are clustered in parallel
   using AllocConfig =
       PoolAllocatorConfig<Hit2D, essmath::units::GiB, MyVector<Hit2D>::MinReserveCount,
-                          false, true>;
+                          false, true, true>;
   static AllocConfig::PoolType *Pool;
   static PoolAllocator<AllocConfig> Alloc;
   static std::size_t MaxAllocCount;
@@ -204,11 +206,10 @@ bool operator!=(const Hit2DVectorAllocator<T> &,
 
 using Hit2DVector = MyVector<Hit2D, Hit2DVectorAllocator<Hit2D>>;
 
-/// \brief convenience function for sorting Hit2Ds by increasing time
+/// \brief convenience function for sorting Hit2Ds by increasing time, stable
+/// and fast for nearly sorted hits, see RadixSort.h
 inline void sort_chronologically(Hit2DVector &&hits) {
-  std::sort(hits.begin(), hits.end(), [](const Hit2D &hit1, const Hit2D &hit2) {
-    return hit1.time < hit2.time;
-  });
+  radixsort::sortByTime(hits.data(), hits.size());
 }
 
 /// \brief convenience function for sorting Hits by increasing coordinate
@@ -12,6 +12,7 @@
 #include <common/memory/PoolAllocator.h>
 #include <common/math/Units.h>
 #include <common/reduction/Hit.h>
+#include <common/reduction/RadixSort.h>
 
 #include <filesystem>
 #include <sstream>
@@ -205,11 +206,10 @@ bool operator!=(const HitVectorAllocator<T> &, const HitVectorAllocator<U> &) {
 // using HitVector = MyVector<Hit, GreedyHitAllocator<Hit>>;
 using HitVector = MyVector<Hit, HitVectorAllocator<Hit>>;
 
-/// \brief convenience function for sorting Hits by increasing time
+/// \brief convenience function for sorting Hits by increasing time, stable
+/// and fast for nearly sorted hits, see RadixSort.h
 inline void sort_chronologically(HitVector &hits) {
-  std::sort(hits.begin(), hits.end(), [](const Hit &hit1, const Hit &hit2) {
-    return hit1.time < hit2.time;
-  });
+  radixsort::sortByTime(hits.data(), hits.size());
 }
 
 /// \brief convenience function for sorting Hits by increasing coordinate
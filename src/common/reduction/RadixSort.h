@@ -0,0 +1,123 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+///===--------------------------------------------------------------------===///
+///
+/// \file RadixSort.h
+/// \brief Stable sort of hits by their 64 bit time stamp
+///
+/// Hits from a readout packet are usually in time order or close to it, so
+/// the input is scanned first. Sorted input is left alone, nearly sorted
+/// input is finished with insertion sort and anything else is sorted with
+/// an LSD radix sort over the bytes of the time stamps which actually
+/// differ, typically two or three passes instead of eight.
+///
+///===--------------------------------------------------------------------===///
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace radixsort {
+
+/// Inputs up to this size are always tried with insertion sort first
+constexpr size_t SmallCount{32};
+
+/// Insertion sort is tried when at most one in NearlySortedRatio hits is
+/// earlier than its predecessor
+constexpr size_t NearlySortedRatio{16};
+
+/// Insertion sort gives up after this many element moves per hit
+constexpr size_t MovesPerHit{8};
+
+/// \brief insertion sort by time giving up after MaxMoves element moves
+/// \return true if the hits are sorted, false if it gave up. The hits are
+///         then still a permutation of the input.
+template <typename T>
+bool insertionSortByTime(T *Hits, size_t Count, size_t MaxMoves) {
+  size_t Moves{0};
+  for (size_t i = 1; i < Count; i++) {
+    if (Hits[i].time >= Hits[i - 1].time) {
+      continue;
+    }
+    T Hit = Hits[i];
+    size_t j = i;
+    while (j > 0 and Hits[j - 1].time > Hit.time) {
+      Hits[j] = Hits[j - 1];
+      j--;
+    }
+    Hits[j] = Hit;
+    Moves += i - j;
+    if (Moves > MaxMoves) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief LSD radix sort by time, one pass per byte set in VaryingBits
+template <typename T>
+void lsdSortByTime(T *Hits, size_t Count, uint64_t VaryingBits) {
+  // reused between calls, one per thread as Timepix3 sorts on a thread pool
+  static thread_local std::vector<T> Scratch;
+  if (Scratch.size() < Count) {
+    Scratch.resize(Count);
+  }
+
+  T *Source = Hits;
+  T *Destination = Scratch.data();
+  for (int Shift = 0; Shift < 64; Shift += 8) {
+    if (((VaryingBits >> Shift) & 0xff) == 0) {
+      continue;
+    }
+
+    size_t Offsets[256] = {0};
+    for (size_t i = 0; i < Count; i++) {
+      Offsets[(Source[i].time >> Shift) & 0xff]++;
+    }
+    size_t Sum{0};
+    for (auto &Offset : Offsets) {
+      size_t Bucket = Offset;
+      Offset = Sum;
+      Sum += Bucket;
+    }
+    for (size_t i = 0; i < Count; i++) {
+      Destination[Offsets[(Source[i].time >> Shift) & 0xff]++] = Source[i];
+    }
+    std::swap(Source, Destination);
+  }
+
+  if (Source != Hits) {
+    std::memcpy(static_cast<void *>(Hits), Source, Count * sizeof(T));
+  }
+}
+
+/// \brief stable sort of Count hits by increasing time
+template <typename T> void sortByTime(T *Hits, size_t Count) {
+  if (Count < 2) {
+    return;
+  }
+
+  size_t Descents{0};
+  uint64_t VaryingBits{0};
+  for (size_t i = 1; i < Count; i++) {
+    Descents += Hits[i].time < Hits[i - 1].time;
+    VaryingBits |= Hits[i].time ^ Hits[0].time;
+  }
+  if (Descents == 0) {
+    return;
+  }
+
+  if (Count <= SmallCount) {
+    insertionSortByTime(Hits, Count, Count * Count);
+    return;
+  }
+  if (Descents <= Count / NearlySortedRatio and
+      insertionSortByTime(Hits, Count, Count * MovesPerHit)) {
+    return;
+  }
+  lsdSortByTime(Hits, Count, VaryingBits);
+}
+
+} // namespace radixsort
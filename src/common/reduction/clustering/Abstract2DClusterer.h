@@ -1,4 +1,4 @@
-// Copyright (C) 2023 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. See LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file Abstract2DClusterer.h
@@ -64,8 +64,9 @@ struct Cluster2DPoolStorage {
     void *nodeGuess2;
   };
   enum : size_t { Bytes_1GB = essmath::units::GiB, ObjectsPerSlot = 1 };
-  using AllocConfig =
-      PoolAllocatorConfig<StorageGuess, Bytes_1GB, ObjectsPerSlot, false, true>;
+  // thread safe as the timepix3 sub frames are clustered in parallel
+  using AllocConfig = PoolAllocatorConfig<StorageGuess, Bytes_1GB,
+                                          ObjectsPerSlot, false, true, true>;
   static AllocConfig::PoolType *Pool;
   static PoolAllocator<AllocConfig> Alloc;
 };
@@ -0,0 +1,193 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file Grid2DClusterer.cpp
+/// \brief Grid2DClusterer class implementation
+///
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <common/debug/Trace.h>
+#include <common/reduction/clustering/Grid2DClusterer.h>
+#include <sstream>
+// #undef TRC_LEVEL
+// #define TRC_LEVEL TRC_L_DEB
+
+namespace {
+constexpr uint32_t ColumnBits{16};
+constexpr uint32_t LastColumn{(1u << ColumnBits) - 1};
+} // namespace
+
+Grid2DClusterer::Grid2DClusterer(uint64_t max_time_gap, uint16_t max_coord_gap)
+    : Abstract2DClusterer(), max_time_gap_(max_time_gap),
+      max_coord_gap_(max_coord_gap),
+      max_coord_gap_sqr_(int64_t(max_coord_gap) * max_coord_gap),
+      cell_size_(std::max<uint16_t>(max_coord_gap, 1)) {}
+
+void Grid2DClusterer::insert(const Hit2D &hit) {
+  /// Process time-cluster if time gap to next hit is large enough
+  if (!current_time_cluster_.empty() &&
+      (hit.time - current_time_cluster_.back().time) > max_time_gap_) {
+    flush();
+  }
+
+  /// Insert hit in either case
+  current_time_cluster_.emplace_back(hit);
+}
+
+void Grid2DClusterer::cluster(const Hit2DVector &hits) {
+  /// It is assumed that hits are sorted in time
+  for (const auto &hit : hits) {
+    insert(hit);
+  }
+}
+
+void Grid2DClusterer::flush() {
+  XTRACE(EVENT, DEB, "Flushing clusterer");
+  if (current_time_cluster_.empty()) {
+    return;
+  }
+  cluster_by_grid();
+  current_time_cluster_.clear();
+}
+
+void Grid2DClusterer::cluster_by_grid() {
+  uint32_t clusterSize = current_time_cluster_.size();
+  XTRACE(DATA, DEB, "%u events in time window", clusterSize);
+
+  cells_.resize(clusterSize);
+  parent_.resize(clusterSize);
+  for (uint32_t i = 0; i < clusterSize; i++) {
+    const Hit2D &hit = current_time_cluster_[i];
+    uint32_t column = hit.x_coordinate / cell_size_;
+    uint32_t row = hit.y_coordinate / cell_size_;
+    cells_[i] = {(row << ColumnBits) | column, i};
+    parent_[i] = i;
+  }
+  std::sort(cells_.begin(), cells_.end(),
+            [](const CellEntry &a, const CellEntry &b) {
+              return a.cell < b.cell;
+            });
+
+  // Hits closer than max_coord_gap are in the same or in adjacent cells.
+  // For each cell, compare with itself and with the four adjacent cells
+  // sorted after it, so each pair of cells is compared once.
+  size_t begin = 0;
+  while (begin < cells_.size()) {
+    uint32_t cell = cells_[begin].cell;
+    size_t end = begin + 1;
+    while (end < cells_.size() and cells_[end].cell == cell) {
+      end++;
+    }
+
+    join_cells(begin, end, begin, end);
+
+    uint32_t column = cell & LastColumn;
+    uint32_t nextRow = cell + (1u << ColumnBits);
+    uint32_t neighbours[4];
+    int neighbourCount = 0;
+    if (column != LastColumn) {
+      neighbours[neighbourCount++] = cell + 1;
+    }
+    if (nextRow > cell) {
+      if (column != 0) {
+        neighbours[neighbourCount++] = nextRow - 1;
+      }
+      neighbours[neighbourCount++] = nextRow;
+      if (column != LastColumn) {
+        neighbours[neighbourCount++] = nextRow + 1;
+      }
+    }
+
+    for (int n = 0; n < neighbourCount; n++) {
+      uint32_t neighbour = neighbours[n];
+      size_t other = find_cell(neighbour, end);
+      size_t otherEnd = other;
+      while (otherEnd < cells_.size() and cells_[otherEnd].cell == neighbour) {
+        otherEnd++;
+      }
+      join_cells(begin, end, other, otherEnd);
+    }
+    begin = end;
+  }
+
+  // Clusters are ordered by their first hit, and hits within a cluster are
+  // in time order, as for Hierarchical2DClusterer
+  cluster_of_.resize(clusterSize);
+  uint32_t clusterCount = 0;
+  for (uint32_t i = 0; i < clusterSize; i++) {
+    if (find_root(i) == i) {
+      cluster_of_[i] = clusterCount++;
+    }
+  }
+
+  std::vector<Cluster2D> space_clusters(clusterCount);
+  for (uint32_t i = 0; i < clusterSize; i++) {
+    space_clusters[cluster_of_[find_root(i)]].insert(current_time_cluster_[i]);
+  }
+  for (auto &cluster : space_clusters) {
+    stash_cluster(cluster);
+  }
+}
+
+void Grid2DClusterer::join_cells(size_t a_begin, size_t a_end, size_t b_begin,
+                                 size_t b_end) {
+  bool sameCell = (a_begin == b_begin);
+  for (size_t a = a_begin; a < a_end; a++) {
+    const Hit2D &hitA = current_time_cluster_[cells_[a].hit];
+    for (size_t b = sameCell ? a + 1 : b_begin; b < b_end; b++) {
+      const Hit2D &hitB = current_time_cluster_[cells_[b].hit];
+      int64_t dx = int64_t(hitA.x_coordinate) - hitB.x_coordinate;
+      int64_t dy = int64_t(hitA.y_coordinate) - hitB.y_coordinate;
+      if (dx * dx + dy * dy < max_coord_gap_sqr_) {
+        join(cells_[a].hit, cells_[b].hit);
+      }
+    }
+  }
+}
+
+size_t Grid2DClusterer::find_cell(uint32_t cell, size_t from) const {
+  auto it = std::lower_bound(
+      cells_.begin() + from, cells_.end(), cell,
+      [](const CellEntry &entry, uint32_t value) { return entry.cell < value; });
+  if (it == cells_.end() or it->cell != cell) {
+    return cells_.size();
+  }
+  return it - cells_.begin();
+}
+
+uint32_t Grid2DClusterer::find_root(uint32_t hit) {
+  while (parent_[hit] != hit) {
+    parent_[hit] = parent_[parent_[hit]];
+    hit = parent_[hit];
+  }
+  return hit;
+}
+
+void Grid2DClusterer::join(uint32_t a, uint32_t b) {
+  uint32_t rootA = find_root(a);
+  uint32_t rootB = find_root(b);
+  if (rootA < rootB) {
+    parent_[rootB] = rootA;
+  } else if (rootB < rootA) {
+    parent_[rootA] = rootB;
+  }
+}
+
+std::string Grid2DClusterer::config(const std::string &prepend) const {
+  std::stringstream ss;
+  ss << "Grid2DClusterer:\n";
+  ss << prepend << fmt::format("max_time_gap={}\n", max_time_gap_);
+  ss << prepend << fmt::format("max_coord_gap={}\n", max_coord_gap_);
+  return ss.str();
+}
+
+std::string Grid2DClusterer::status(const std::string &prepend,
+                                    bool verbose) const {
+  std::stringstream ss;
+  ss << Abstract2DClusterer::status(prepend, verbose);
+  if (!current_time_cluster_.empty())
+    ss << prepend << "Current time cluster:\n"
+       << to_string(current_time_cluster_, prepend + "  ") + "\n";
+  return ss.str();
+}
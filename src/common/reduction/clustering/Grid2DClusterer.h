@@ -0,0 +1,98 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file Grid2DClusterer.h
+/// \brief Grid2DClusterer class definition. Clusters 2D hits in time and
+/// then in space, using a uniform grid to find neighbouring hits.
+///
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <common/reduction/clustering/Abstract2DClusterer.h>
+#include <cstdint>
+#include <fmt/format.h>
+#include <vector>
+
+/// \class Grid2DClusterer Grid2DClusterer.h
+/// \brief Clusterer for 2D hits in time, and then space. Same interface and
+///         time clustering as Hierarchical2DClusterer.
+///
+/// Hits of a time cluster are put in a uniform grid with a cell size of
+/// max_coord_gap, so hits closer than max_coord_gap are in the same or in
+/// adjacent cells. Only hits in those cells are compared, using integer
+/// squared distances, and hits closer than max_coord_gap are joined with
+/// union-find. The space clusters are the connected components, which makes
+/// the cost about linear in the number of hits instead of quadratic.
+///
+/// \note Hierarchical2DClusterer only joins hits close to the first hit of a
+///       cluster, whereas this clusterer joins all hits connected by a chain
+///       of close hits. The two give the same clusters when each cluster is
+///       smaller than max_coord_gap.
+class Grid2DClusterer : public Abstract2DClusterer {
+public:
+  /// \brief Grid2DClusterer constructor
+  /// \param max_time_gap maximum difference in time between hits such that
+  ///        they would be considered part of the same cluster
+  /// \param max_coord_gap hits closer than this are considered part of the
+  ///        same cluster
+  Grid2DClusterer(uint64_t max_time_gap, uint16_t max_coord_gap);
+
+  /// \brief insert new hit and perform clustering
+  /// \param hit to be added to cluster. Hits must be chronological between
+  ///         subsequent calls.
+  void insert(const Hit2D &hit) override;
+
+  /// \brief insert new hits and perform clustering
+  /// \param hits container of hits to be processed. Hit2Ds must be
+  ///        chronologically sorted within the container and between
+  ///        subsequent calls.
+  void cluster(const Hit2DVector &hits) override;
+
+  /// \brief complete clustering for any remaining hits
+  void flush() override;
+
+  /// \brief print configuration of Grid2DClusterer
+  std::string config(const std::string &prepend) const override;
+
+  /// \brief print current status of Grid2DClusterer
+  std::string status(const std::string &prepend, bool verbose) const override;
+
+private:
+  uint64_t const max_time_gap_;
+  uint16_t const max_coord_gap_;
+  int64_t const max_coord_gap_sqr_;
+  uint16_t const cell_size_;
+
+  Hit2DVector
+      current_time_cluster_; ///< kept in memory until time gap encountered
+
+  /// \brief grid cell of a hit in current_time_cluster_
+  struct CellEntry {
+    uint32_t cell; ///< cell row * 2^16 + cell column
+    uint32_t hit;  ///< index in current_time_cluster_
+  };
+
+  // Work areas reused between time clusters
+  std::vector<CellEntry> cells_;     ///< hits sorted by cell
+  std::vector<uint32_t> parent_;     ///< union-find parent of each hit
+  std::vector<uint32_t> cluster_of_; ///< output cluster of each root
+
+  /// \brief helper function to cluster hits in current_time_cluster_
+  void cluster_by_grid();
+
+  /// \brief joins the hits in cell run [a_begin, a_end) with those in
+  ///        [b_begin, b_end) which are closer than max_coord_gap
+  void join_cells(size_t a_begin, size_t a_end, size_t b_begin,
+                  size_t b_end);
+
+  /// \brief returns the begin of the run of the given cell in cells_, or
+  ///        cells_.size() if there is no such cell
+  size_t find_cell(uint32_t cell, size_t from) const;
+
+  /// \brief returns the union-find root of hit
+  uint32_t find_root(uint32_t hit);
+
+  /// \brief merges the sets of hits a and b, the root is the smaller index
+  void join(uint32_t a, uint32_t b);
+};
@@ -0,0 +1,58 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief Hierarchical2DClusterer versus Grid2DClusterer on dense synthetic
+/// frames
+///
+/// All hits of a frame are within the time gap, as in a bright Timepix3
+/// frame. The hits are small blobs at random positions on a 256 x 256
+/// camera, the benchmark argument is the number of hits per frame.
+
+#include <benchmark/benchmark.h>
+#include <common/reduction/clustering/Grid2DClusterer.h>
+#include <common/reduction/clustering/Hierarchical2DClusterer.h>
+#include <random>
+
+static constexpr uint64_t MaxTimeGapNS{500};
+static constexpr uint16_t MaxCoordinateGap{5};
+
+static Hit2DVector makeFrame(size_t Hits) {
+  std::mt19937 Random(42);
+  std::uniform_int_distribution<int> Centre(0, 250);
+  std::uniform_int_distribution<int> Offset(0, 3);
+  std::uniform_int_distribution<int> BlobSize(1, 10);
+  Hit2DVector Frame;
+  uint64_t Time{0};
+  while (Frame.size() < Hits) {
+    int X = Centre(Random);
+    int Y = Centre(Random);
+    for (int i = BlobSize(Random); i > 0 and Frame.size() < Hits; i--) {
+      Frame.push_back({Time++, uint16_t(X + Offset(Random)),
+                       uint16_t(Y + Offset(Random)), 1});
+    }
+  }
+  return Frame;
+}
+
+template <typename ClustererType>
+static void ClusterDenseFrame(benchmark::State &state) {
+  Hit2DVector Frame = makeFrame(state.range(0));
+  ClustererType Clusterer(MaxTimeGapNS, MaxCoordinateGap);
+
+  for (auto _ : state) {
+    Clusterer.cluster(Frame);
+    Clusterer.flush();
+    benchmark::DoNotOptimize(Clusterer.clusters.size());
+    Clusterer.clusters.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * Frame.size());
+}
+
+BENCHMARK_TEMPLATE(ClusterDenseFrame, Hierarchical2DClusterer)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096);
+BENCHMARK_TEMPLATE(ClusterDenseFrame, Grid2DClusterer)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096);
+
+BENCHMARK_MAIN();
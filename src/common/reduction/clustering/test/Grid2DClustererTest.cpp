@@ -0,0 +1,169 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+#include <common/reduction/clustering/Grid2DClusterer.h>
+#include <common/reduction/clustering/Hierarchical2DClusterer.h>
+
+#include <common/testutils/TestBase.h>
+#include <random>
+
+class Grid2DClustererTest : public TestBase {
+protected:
+  void mock_cluster(Hit2DVector &ret, uint16_t x_start, uint16_t x_end,
+                    uint16_t x_step, uint16_t y_start, uint16_t y_end,
+                    uint16_t y_step, uint64_t time_start, uint64_t time_end,
+                    uint64_t time_step) {
+    Hit2D e;
+    e.weight = 1;
+    for (e.time = time_start; e.time <= time_end; e.time += time_step)
+      for (e.x_coordinate = x_start; e.x_coordinate <= x_end;
+           e.x_coordinate += x_step) {
+        for (e.y_coordinate = y_start; e.y_coordinate <= y_end;
+             e.y_coordinate += y_step) {
+          ret.push_back(e);
+        }
+      }
+  }
+
+  /// Small blobs of hits on a grid of blob centres, blobs are smaller than
+  /// the coordinate gap and further apart than the gap
+  Hit2DVector mock_blobs(uint16_t gap, int frames, int blobs_per_frame) {
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> centre(0, 15);
+    std::uniform_int_distribution<int> offset(0, (gap - 1) / 2);
+    std::uniform_int_distribution<int> size(1, 8);
+    Hit2DVector hits;
+    uint64_t time = 0;
+    for (int frame = 0; frame < frames; frame++) {
+      for (int blob = 0; blob < blobs_per_frame; blob++) {
+        uint16_t cx = centre(random) * 3 * gap;
+        uint16_t cy = centre(random) * 3 * gap;
+        for (int i = size(random); i > 0; i--) {
+          hits.push_back({time++, uint16_t(cx + offset(random)),
+                          uint16_t(cy + offset(random)), 1});
+        }
+      }
+      time += 1000;
+    }
+    return hits;
+  }
+
+  void expect_same_clusters(Abstract2DClusterer &a, Abstract2DClusterer &b) {
+    ASSERT_EQ(a.clusters.size(), b.clusters.size());
+    auto it = b.clusters.begin();
+    for (auto &cluster : a.clusters) {
+      ASSERT_EQ(cluster.hitCount(), it->hitCount());
+      ASSERT_EQ(cluster.timeStart(), it->timeStart());
+      ASSERT_EQ(cluster.timeEnd(), it->timeEnd());
+      ASSERT_EQ(cluster.xCoordCenter(), it->xCoordCenter());
+      ASSERT_EQ(cluster.yCoordCenter(), it->yCoordCenter());
+      it++;
+    }
+  }
+};
+
+TEST_F(Grid2DClustererTest, ZeroTimeGap) {
+  Hit2DVector hc;
+  mock_cluster(hc, 0, 0, 1, 0, 0, 1, 1, 10, 1);
+
+  Grid2DClusterer clusterer(0, 0);
+  clusterer.cluster(hc);
+
+  EXPECT_EQ(clusterer.stats_cluster_count, 9);
+  EXPECT_EQ(clusterer.clusters.size(), 9);
+
+  clusterer.flush();
+  EXPECT_EQ(clusterer.stats_cluster_count, 10);
+  EXPECT_EQ(clusterer.clusters.size(), 10);
+}
+
+TEST_F(Grid2DClustererTest, ZeroCoordGapSplitsAllHits) {
+  Hit2DVector hc;
+  mock_cluster(hc, 0, 3, 1, 0, 3, 1, 1, 1, 1);
+
+  Grid2DClusterer clusterer(10, 0);
+  clusterer.cluster(hc);
+  clusterer.flush();
+  EXPECT_EQ(clusterer.clusters.size(), 16);
+}
+
+TEST_F(Grid2DClustererTest, SameAsHierarchical) {
+  for (uint16_t gap : {2, 5, 10}) {
+    Hit2DVector hits = mock_blobs(gap, 50, 20);
+
+    Hierarchical2DClusterer hierarchical(10, gap);
+    Grid2DClusterer grid(10, gap);
+    hierarchical.cluster(hits);
+    hierarchical.flush();
+    grid.cluster(hits);
+    grid.flush();
+
+    EXPECT_GT(grid.clusters.size(), 50);
+    EXPECT_EQ(grid.stats_cluster_count, hierarchical.stats_cluster_count);
+    expect_same_clusters(grid, hierarchical);
+  }
+}
+
+/// A line of hits 3 apart is one cluster with a gap of 4, while
+/// Hierarchical2DClusterer only joins the hits close to the first hit
+TEST_F(Grid2DClustererTest, ChainIsOneCluster) {
+  Hit2DVector hc;
+  mock_cluster(hc, 0, 30, 3, 7, 7, 1, 1, 1, 1);
+
+  Grid2DClusterer grid(10, 4);
+  grid.cluster(hc);
+  grid.flush();
+  ASSERT_EQ(grid.clusters.size(), 1);
+  EXPECT_EQ(grid.clusters.front().hitCount(), 11);
+
+  Hierarchical2DClusterer hierarchical(10, 4);
+  hierarchical.cluster(hc);
+  hierarchical.flush();
+  EXPECT_EQ(hierarchical.clusters.size(), 6);
+}
+
+TEST_F(Grid2DClustererTest, DistanceIsStrictlyLessThanGap) {
+  Hit2DVector hc;
+  hc.push_back({1, 10, 10, 1});
+  hc.push_back({2, 13, 14, 1}); // distance 5
+  hc.push_back({3, 40, 40, 1});
+  hc.push_back({4, 44, 43, 1}); // distance 5
+
+  Grid2DClusterer at_gap(10, 5);
+  at_gap.cluster(hc);
+  at_gap.flush();
+  EXPECT_EQ(at_gap.clusters.size(), 4);
+
+  Grid2DClusterer above_gap(10, 6);
+  above_gap.cluster(hc);
+  above_gap.flush();
+  EXPECT_EQ(above_gap.clusters.size(), 2);
+}
+
+TEST_F(Grid2DClustererTest, CoordinateLimits) {
+  Hit2DVector hc;
+  hc.push_back({1, 65535, 0, 1});
+  hc.push_back({2, 0, 1, 1});
+  hc.push_back({3, 65535, 65535, 1});
+  hc.push_back({4, 65534, 65535, 1});
+
+  Grid2DClusterer clusterer(10, 2);
+  clusterer.cluster(hc);
+  clusterer.flush();
+  ASSERT_EQ(clusterer.clusters.size(), 3);
+  EXPECT_EQ(clusterer.clusters.back().hitCount(), 2);
+}
+
+/// Only a test in the broadest sense, mainly calling a string formatting fct.
+TEST_F(Grid2DClustererTest, DebugString) {
+  Grid2DClusterer clusterer(0, 0);
+  std::string DebugString = clusterer.config("");
+  size_t OldLen = DebugString.size();
+  DebugString = clusterer.config("prefix_");
+  ASSERT_TRUE(DebugString.size() > OldLen);
+  ASSERT_FALSE(clusterer.status("", true).empty());
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief ChronoMerger throughput with several modules at MHz event rates
+///
+/// Each module produces events at 1 MHz in packets of 100 events, with a
+/// little jitter within a module. Packets are inserted round-robin and the
+/// ready events are popped after each packet, as a processing loop would.
+/// The arguments are the number of modules and the maximum latency in ns.
+
+#include <benchmark/benchmark.h>
+#include <common/reduction/ChronoMerger.h>
+#include <random>
+
+static constexpr size_t EventsPerPacket{100};
+static constexpr uint64_t EventSpacingNS{1000};
+
+static void ChronoMergerRelease(benchmark::State &state) {
+  size_t Modules = state.range(0);
+  uint64_t MaximumLatency = state.range(1);
+
+  std::mt19937_64 Random(1);
+  std::vector<NeutronEvent> Packet(EventsPerPacket);
+  std::vector<uint64_t> ModuleTime(Modules, 1'000'000);
+  ChronoMerger Merger(MaximumLatency, Modules);
+
+  int64_t Events{0};
+  uint64_t Checksum{0};
+  for (auto _ : state) {
+    for (size_t Module = 0; Module < Modules; Module++) {
+      uint64_t &Time = ModuleTime[Module];
+      for (auto &Event : Packet) {
+        Time += EventSpacingNS;
+        Event = {Time - Random() % 200, uint32_t(Module)};
+      }
+      for (auto &Event : Packet) {
+        Merger.insert(Module, Event);
+      }
+      Merger.sort();
+      while (Merger.ready()) {
+        Checksum += Merger.pop_earliest().time;
+      }
+    }
+    Events += Modules * EventsPerPacket;
+  }
+  benchmark::DoNotOptimize(Checksum);
+  state.SetItemsProcessed(Events);
+}
+BENCHMARK(ChronoMergerRelease)
+    ->ArgsProduct({{2, 8, 32}, {10'000, 200'000}});
+
+BENCHMARK_MAIN();
@@ -3,6 +3,9 @@
 #include <common/reduction/ChronoMerger.h>
 #include <common/testutils/TestBase.h>
 
+#include <algorithm>
+#include <random>
+
 class ChronoMergerTest : public TestBase {
 protected:
   ChronoMerger merger{100, 3};
@@ -69,9 +72,7 @@ TEST_F(ChronoMergerTest, Earliest) {
   merger.insert(1, {7, 0});
   merger.insert(0, {8, 0});
 
-  EXPECT_EQ(merger.earliest(), 5);
-  merger.sort();
-
+  // no sort needed, the queue is always in chronological order
   EXPECT_EQ(merger.earliest(), 3);
   merger.pop_earliest();
   EXPECT_EQ(merger.earliest(), 4);
@@ -120,6 +121,57 @@ TEST_F(ChronoMergerTest, Ready) {
   EXPECT_FALSE(merger.ready());
 }
 
+TEST_F(ChronoMergerTest, OutOfOrderWithinModule) {
+  merger.insert(1, {10, 1});
+  merger.insert(1, {8, 2});
+  merger.insert(1, {9, 3});
+  merger.insert(1, {9, 4});
+  merger.insert(0, {9, 5});
+  EXPECT_EQ(merger.size(), 5);
+  EXPECT_EQ(merger.horizon(), 0);
+
+  std::vector<uint32_t> pixels;
+  while (!merger.empty())
+    pixels.push_back(merger.pop_earliest().pixel_id);
+  EXPECT_EQ(pixels, std::vector<uint32_t>({2, 5, 3, 4, 1}));
+}
+
+TEST_F(ChronoMergerTest, InsertList) {
+  std::list<NeutronEvent> events{{5, 0}, {3, 1}, {7, 2}};
+  merger.insert(2, events);
+  EXPECT_TRUE(events.empty());
+  EXPECT_EQ(merger.size(), 3);
+  EXPECT_EQ(merger.earliest(), 3);
+}
+
+TEST_F(ChronoMergerTest, SameAsSortedInput) {
+  ChronoMerger big_merger{1000, 8};
+  std::mt19937_64 random(1);
+  std::vector<NeutronEvent> expected;
+  std::vector<NeutronEvent> popped;
+  uint64_t time = 1000;
+  for (uint32_t i = 0; i < 20000; i++) {
+    time += random() % 100;
+    // modules are behind by up to 500, and events jitter by up to 50
+    NeutronEvent event{time - random() % 500 + random() % 50, i};
+    big_merger.insert(random() % 8, event);
+    expected.push_back(event);
+    while (big_merger.ready())
+      popped.push_back(big_merger.pop_earliest());
+  }
+  while (!big_merger.empty())
+    popped.push_back(big_merger.pop_earliest());
+
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const NeutronEvent &e1, const NeutronEvent &e2) {
+                     return e1.time < e2.time;
+                   });
+  ASSERT_EQ(popped.size(), expected.size());
+  for (size_t i = 0; i < popped.size(); i++) {
+    ASSERT_EQ(popped[i].time, expected[i].time);
+  }
+}
+
 TEST_F(ChronoMergerTest, Reset) {
   merger.insert(0, {5, 0});
   merger.insert(1, {4, 0});
@@ -0,0 +1,138 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+#include <common/reduction/EventBuilder2DFlusher.h>
+#include <common/testutils/TestBase.h>
+
+class EventBuilder2DFlusherTest : public TestBase {
+protected:
+  std::vector<EventBuilder2D> Builders{std::vector<EventBuilder2D>(4)};
+
+  void SetUp() override {
+    for (auto &builder : Builders) {
+      builder.matcher.setMaximumTimeGap(500);
+      builder.ClustererX.setMaximumCoordGap(2);
+      builder.ClustererY.setMaximumCoordGap(2);
+    }
+  }
+
+  void insert(EventBuilder2DFlusher &Flusher, size_t Index, Hit hit) {
+    Builders[Index].insert(hit);
+    Flusher.touch(Index);
+  }
+};
+
+TEST_F(EventBuilder2DFlusherTest, Constructor) {
+  EventBuilder2DFlusher Flusher(Builders.size(), 0);
+  ASSERT_TRUE(Flusher.flushed().empty());
+  ASSERT_EQ(Flusher.Stats.Flushes, 0);
+  ASSERT_EQ(Flusher.Stats.BuildersFlushed, 0);
+}
+
+TEST_F(EventBuilder2DFlusherTest, OnlyTouchedBuildersFlushed) {
+  EventBuilder2DFlusher Flusher(Builders.size(), 0);
+  insert(Flusher, 1, {100, 5, 10, PlaneX});
+  insert(Flusher, 1, {110, 6, 10, PlaneY});
+  insert(Flusher, 3, {100, 5, 10, PlaneX});
+  insert(Flusher, 1, {120, 7, 10, PlaneY});
+
+  Flusher.flush(Builders, true, 0);
+  ASSERT_EQ(Flusher.flushed(), std::vector<size_t>({1, 3}));
+  ASSERT_EQ(Builders[0].matcher.Stats.MatchAttemptCount, 0);
+  ASSERT_EQ(Builders[1].matcher.Stats.MatchAttemptCount, 1);
+  ASSERT_EQ(Builders[2].matcher.Stats.MatchAttemptCount, 0);
+  ASSERT_EQ(Builders[3].matcher.Stats.MatchAttemptCount, 1);
+  ASSERT_EQ(Builders[1].Events.size(), 1);
+  ASSERT_TRUE(Builders[1].Events[0].both_planes());
+  ASSERT_EQ(Builders[3].Events.size(), 1);
+  ASSERT_TRUE(Builders[1].HitsX.empty());
+
+  ASSERT_EQ(Flusher.Stats.Flushes, 1);
+  ASSERT_EQ(Flusher.Stats.BuildersFlushed, 2);
+  ASSERT_EQ(Flusher.Stats.LastBuildersFlushed, 2);
+
+  // nothing touched, nothing flushed
+  Flusher.flush(Builders, true, 0);
+  ASSERT_TRUE(Flusher.flushed().empty());
+  ASSERT_EQ(Flusher.Stats.Flushes, 2);
+  ASSERT_EQ(Flusher.Stats.BuildersFlushed, 2);
+  ASSERT_EQ(Flusher.Stats.LastBuildersFlushed, 0);
+  ASSERT_EQ(Builders[1].matcher.Stats.MatchAttemptCount, 1);
+}
+
+TEST_F(EventBuilder2DFlusherTest, ClusterAcrossPacketsWithoutDelay) {
+  EventBuilder2DFlusher Flusher(Builders.size(), 0);
+  insert(Flusher, 0, {100, 5, 10, PlaneX});
+  Flusher.flush(Builders, true, 0);
+  insert(Flusher, 0, {110, 6, 10, PlaneY});
+  Flusher.flush(Builders, true, 1000);
+
+  // the full flush per packet splits the event
+  ASSERT_EQ(Builders[0].Events.size(), 2);
+  ASSERT_FALSE(Builders[0].Events[0].both_planes());
+  ASSERT_FALSE(Builders[0].Events[1].both_planes());
+}
+
+TEST_F(EventBuilder2DFlusherTest, ClusterAcrossPacketsWithDelay) {
+  EventBuilder2DFlusher Flusher(Builders.size(), 10'000);
+  insert(Flusher, 0, {100, 5, 10, PlaneX});
+  Flusher.flush(Builders, true, 0);
+  ASSERT_EQ(Flusher.flushed(), std::vector<size_t>({0}));
+  insert(Flusher, 0, {110, 6, 10, PlaneY});
+  Flusher.flush(Builders, true, 1000);
+  ASSERT_EQ(Flusher.flushed(), std::vector<size_t>({0}));
+  ASSERT_TRUE(Builders[0].Events.empty());
+  ASSERT_EQ(Flusher.Stats.DeferredFullFlushes, 0);
+
+  // untouched, but fully flushed once the delay has passed
+  Flusher.flush(Builders, true, 9'999);
+  ASSERT_TRUE(Flusher.flushed().empty());
+  Flusher.flush(Builders, true, 10'000);
+  ASSERT_EQ(Flusher.flushed(), std::vector<size_t>({0}));
+  ASSERT_EQ(Flusher.Stats.DeferredFullFlushes, 1);
+  ASSERT_EQ(Builders[0].Events.size(), 1);
+  ASSERT_TRUE(Builders[0].Events[0].both_planes());
+
+  // no longer pending
+  Flusher.flush(Builders, true, 30'000);
+  ASSERT_TRUE(Flusher.flushed().empty());
+  ASSERT_EQ(Flusher.Stats.DeferredFullFlushes, 1);
+}
+
+TEST_F(EventBuilder2DFlusherTest, IdleFlushAfterDelay) {
+  EventBuilder2DFlusher Flusher(Builders.size(), 10'000);
+  ASSERT_FALSE(Flusher.pending());
+  insert(Flusher, 1, {100, 5, 10, PlaneX});
+  insert(Flusher, 1, {110, 6, 10, PlaneY});
+  Flusher.flush(Builders, true, 0);
+  ASSERT_TRUE(Flusher.pending());
+  ASSERT_TRUE(Builders[1].Events.empty());
+
+  // no more hits arrive, idle flushes until the delay has passed
+  Flusher.flush(Builders, true, 5'000);
+  ASSERT_TRUE(Flusher.flushed().empty());
+  ASSERT_TRUE(Flusher.pending());
+  Flusher.flush(Builders, true, 10'000);
+  ASSERT_EQ(Flusher.flushed(), std::vector<size_t>({1}));
+  ASSERT_FALSE(Flusher.pending());
+  ASSERT_EQ(Builders[1].Events.size(), 1);
+  ASSERT_TRUE(Builders[1].Events[0].both_planes());
+  ASSERT_EQ(Flusher.Stats.DeferredFullFlushes, 1);
+}
+
+TEST_F(EventBuilder2DFlusherTest, TouchedAfterDelayFullyFlushedOnce) {
+  EventBuilder2DFlusher Flusher(Builders.size(), 10'000);
+  insert(Flusher, 2, {100, 5, 10, PlaneX});
+  Flusher.flush(Builders, false, 0);
+  insert(Flusher, 2, {110, 6, 10, PlaneY});
+  Flusher.flush(Builders, false, 20'000);
+
+  ASSERT_EQ(Flusher.flushed(), std::vector<size_t>({2}));
+  ASSERT_EQ(Builders[2].matcher.Stats.MatchAttemptCount, 2);
+  ASSERT_EQ(Builders[2].Events.size(), 1);
+  ASSERT_EQ(Flusher.Stats.BuildersFlushed, 2);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -9,6 +9,7 @@
 #include <common/reduction/Hit2DVector.h>
 #include <common/testutils/TestBase.h>
 
+#include <algorithm>
 #include <chrono>
 #include <random>
 
@@ -52,6 +53,26 @@ TEST_F(Hit2DVectorTest, Visualize) {
   GTEST_COUT << "\n" << visualize(hits, {}, 0, 30) << "\n";
 }
 
+TEST_F(Hit2DVectorTest, SortChronologically) {
+  Hit2DVector hits;
+  for (size_t i = 0; i < 10000; ++i) {
+    Hit2D hit;
+    hit.time = generate_val();
+    hit.x_coordinate = i;
+    hits.push_back(hit);
+  }
+  std::vector<Hit2D> expected(hits.begin(), hits.end());
+  std::stable_sort(
+      expected.begin(), expected.end(),
+      [](const Hit2D &a, const Hit2D &b) { return a.time < b.time; });
+
+  sort_chronologically(std::move(hits));
+  for (size_t i = 0; i < hits.size(); i++) {
+    ASSERT_EQ(hits[i].time, expected[i].time);
+    ASSERT_EQ(hits[i].x_coordinate, expected[i].x_coordinate);
+  }
+}
+
 TEST_F(Hit2DVectorTest, VisualizeEmpty) {
   Hit2DVector hits;
   auto ret = visualize(hits, {}, 0, 30);
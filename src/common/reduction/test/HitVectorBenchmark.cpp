@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <benchmark/benchmark.h>
 #include <common/reduction/HitVector.h>
+#include <random>
 
 static void BM_pushback_hits(benchmark::State &state) {
   HitVector hits;
@@ -12,4 +14,57 @@ static void BM_pushback_hits(benchmark::State &state) {
   }
 }
 BENCHMARK(BM_pushback_hits);
+
+/// Hits of one readout packet, state.range(1) selects the order:
+/// 0 sorted, 1 nearly sorted (every 20th hit a bit late), 2 random
+static HitVector make_packet(size_t count, int order) {
+  std::mt19937_64 random(1);
+  HitVector hits;
+  uint64_t time = 1'700'000'000'000'000'000;
+  for (size_t i = 0; i < count; i++) {
+    Hit hit;
+    time += 1 + random() % 50;
+    hit.time = time;
+    hit.coordinate = i;
+    if (order == 1 and i % 20 == 0) {
+      hit.time -= 200;
+    } else if (order == 2) {
+      hit.time += random() % (50 * count);
+    }
+    hits.push_back(hit);
+  }
+  return hits;
+}
+
+static void BM_sort_std(benchmark::State &state) {
+  HitVector packet = make_packet(state.range(0), state.range(1));
+  HitVector hits;
+  for (auto _ : state) {
+    state.PauseTiming();
+    hits = packet;
+    state.ResumeTiming();
+    std::sort(hits.begin(), hits.end(), [](const Hit &hit1, const Hit &hit2) {
+      return hit1.time < hit2.time;
+    });
+    benchmark::DoNotOptimize(hits.data());
+  }
+  state.SetItemsProcessed(state.iterations() * packet.size());
+}
+
+static void BM_sort_chronologically(benchmark::State &state) {
+  HitVector packet = make_packet(state.range(0), state.range(1));
+  HitVector hits;
+  for (auto _ : state) {
+    state.PauseTiming();
+    hits = packet;
+    state.ResumeTiming();
+    sort_chronologically(hits);
+    benchmark::DoNotOptimize(hits.data());
+  }
+  state.SetItemsProcessed(state.iterations() * packet.size());
+}
+
+BENCHMARK(BM_sort_std)->ArgsProduct({{256, 4096, 65536}, {0, 1, 2}});
+BENCHMARK(BM_sort_chronologically)->ArgsProduct({{256, 4096, 65536}, {0, 1, 2}});
+
 BENCHMARK_MAIN();
@@ -9,6 +9,7 @@
 #include <common/reduction/HitVector.h>
 #include <common/testutils/TestBase.h>
 
+#include <algorithm>
 #include <chrono>
 #include <random>
 
@@ -32,8 +33,95 @@ protected:
   uint16_t generate_val() {
     return std::round(std::max(std::min(dist(gen_), double(max_)), 0.0));
   }
+
+  /// sorts hits with sort_chronologically and checks the result against
+  /// std::stable_sort, the coordinate records the input order
+  void expect_stable_sorted(HitVector &hits) {
+    std::vector<Hit> expected(hits.begin(), hits.end());
+    std::stable_sort(
+        expected.begin(), expected.end(),
+        [](const Hit &a, const Hit &b) { return a.time < b.time; });
+    sort_chronologically(hits);
+    ASSERT_EQ(hits.size(), expected.size());
+    for (size_t i = 0; i < hits.size(); i++) {
+      ASSERT_EQ(hits[i].time, expected[i].time);
+      ASSERT_EQ(hits[i].coordinate, expected[i].coordinate);
+    }
+  }
+
+  HitVector make_hits(size_t count, uint64_t offset) {
+    HitVector hits;
+    for (size_t i = 0; i < count; i++) {
+      Hit hit;
+      hit.time = offset + i * 10;
+      hit.coordinate = i;
+      hits.push_back(hit);
+    }
+    return hits;
+  }
 };
 
+TEST_F(HitVectorTest, SortEmptyAndSingle) {
+  HitVector hits;
+  sort_chronologically(hits);
+  ASSERT_TRUE(hits.empty());
+  hits.push_back(Hit());
+  sort_chronologically(hits);
+  ASSERT_EQ(hits.size(), 1);
+}
+
+TEST_F(HitVectorTest, SortSorted) {
+  HitVector hits = make_hits(5000, 0);
+  expect_stable_sorted(hits);
+}
+
+TEST_F(HitVectorTest, SortReversed) {
+  for (size_t count : {10, 5000}) {
+    HitVector hits = make_hits(count, 0);
+    std::reverse(hits.begin(), hits.end());
+    expect_stable_sorted(hits);
+  }
+}
+
+TEST_F(HitVectorTest, SortNearlySorted) {
+  HitVector hits = make_hits(5000, 1000);
+  for (size_t i = 0; i < hits.size(); i += 100) {
+    hits[i].time -= 35;
+  }
+  expect_stable_sorted(hits);
+
+  // one late hit moves far, insertion sort gives up
+  hits = make_hits(5000, 1000);
+  hits[10].time = 100000;
+  hits[4000].time = 0;
+  expect_stable_sorted(hits);
+}
+
+TEST_F(HitVectorTest, SortRandomWithDuplicates) {
+  HitVector hits;
+  for (size_t i = 0; i < 10000; ++i) {
+    Hit hit;
+    hit.time = generate_val();
+    hit.coordinate = i;
+    hits.push_back(hit);
+  }
+  expect_stable_sorted(hits);
+}
+
+TEST_F(HitVectorTest, SortFullRange) {
+  std::mt19937_64 random(1);
+  HitVector hits;
+  for (size_t i = 0; i < 3000; ++i) {
+    Hit hit;
+    hit.time = random();
+    hit.coordinate = i;
+    hits.push_back(hit);
+  }
+  hits[7].time = 0;
+  hits[8].time = std::numeric_limits<uint64_t>::max();
+  expect_stable_sorted(hits);
+}
+
 TEST_F(HitVectorTest, Visualize) {
   HitVector hits;
   for (size_t i = 0; i < 10000; ++i) {
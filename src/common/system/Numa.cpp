@@ -0,0 +1,69 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Implementation of the NUMA helpers
+///
+//===----------------------------------------------------------------------===//
+
+#include <common/system/Numa.h>
+#include <cstdint>
+#include <string>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+
+int Numa::nodeOfCpu(int Cpu) {
+  // The node is given by a 'nodeN' link in the cpu directory
+  std::string Path = "/sys/devices/system/cpu/cpu" + std::to_string(Cpu);
+  DIR *Dir = opendir(Path.c_str());
+  if (Dir == nullptr) {
+    return -1;
+  }
+  int Node{-1};
+  struct dirent *Entry;
+  while ((Entry = readdir(Dir)) != nullptr) {
+    std::string Name{Entry->d_name};
+    if (Name.size() > 4 and Name.compare(0, 4, "node") == 0) {
+      try {
+        Node = std::stoi(Name.substr(4));
+      } catch (const std::exception &) {
+        Node = -1;
+      }
+      break;
+    }
+  }
+  closedir(Dir);
+  return Node;
+}
+
+bool Numa::moveToNode(void *Address, size_t Length, int Node) {
+  if (Node < 0 or Node >= 64) {
+    return false;
+  }
+  const uintptr_t PageSize = sysconf(_SC_PAGESIZE);
+  uintptr_t Start = ((uintptr_t)Address + PageSize - 1) & ~(PageSize - 1);
+  uintptr_t End = ((uintptr_t)Address + Length) & ~(PageSize - 1);
+  if (End <= Start) {
+    return true; // no whole pages in range
+  }
+
+  unsigned long NodeMask = 1UL << Node;
+  return syscall(SYS_mbind, Start, End - Start, MPOL_BIND, &NodeMask,
+                 sizeof(NodeMask) * 8, MPOL_MF_MOVE) == 0;
+}
+
+#else
+
+int Numa::nodeOfCpu(int) { return -1; }
+
+bool Numa::moveToNode(void *, size_t, int) { return false; }
+
+#endif
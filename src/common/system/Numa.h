@@ -0,0 +1,27 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Minimal NUMA helpers for placing threads and their buffers
+///
+/// Uses sysfs and the mbind() system call directly, so libnuma is not
+/// required. On non Linux systems (and single node machines) the functions
+/// report failure and nothing is changed.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+
+class Numa {
+public:
+  /// \brief NUMA node of a cpu core
+  /// \return node number or -1 if unknown
+  static int nodeOfCpu(int Cpu);
+
+  /// \brief Bind the memory range to a NUMA node, moving pages already
+  /// allocated elsewhere. Only whole pages inside the range are affected.
+  /// \return true on success
+  static bool moveToNode(void *Address, size_t Length, int Node);
+};
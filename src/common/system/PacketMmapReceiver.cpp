@@ -0,0 +1,291 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief Implementation of the memory mapped AF_PACKET (TPACKET_V3) receiver
+///
+/// See https://www.kernel.org/doc/Documentation/networking/packet_mmap.txt
+//===----------------------------------------------------------------------===//
+
+#include <common/debug/Log.h>
+#include <common/debug/Trace.h>
+#include <common/system/PacketMmapReceiver.h>
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <linux/filter.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <netinet/ip.h>
+#include <netinet/udp.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+// #undef TRC_LEVEL
+// #define TRC_LEVEL TRC_L_DEB
+
+int PacketMmapReceiver::send(void const *, int) { return -1; }
+
+#ifdef __linux__
+
+PacketMmapReceiver::PacketMmapReceiver(const std::string &Interface,
+                                       const std::string &IpAddress,
+                                       uint16_t Port, uint32_t BlockSize,
+                                       uint32_t NumBlocks,
+                                       uint32_t BlockTimeoutMS)
+    : BlockSize(BlockSize), NumBlocks(NumBlocks),
+      BlockTimeoutMS(BlockTimeoutMS), BlockHold(NumBlocks, 0) {
+
+  // Protocol 0: nothing is received before the ring is set up and bound
+  if ((SocketFileDescriptor = socket(AF_PACKET, SOCK_RAW, 0)) == -1) {
+    LOG(IPC, Sev::Error, "socket(AF_PACKET) failed: {}", strerror(errno));
+    throw std::runtime_error("system error - socket(AF_PACKET) failed");
+  }
+
+  int Version = TPACKET_V3;
+  if (setsockopt(SocketFileDescriptor, SOL_PACKET, PACKET_VERSION, &Version,
+                 sizeof(Version)) < 0) {
+    close(SocketFileDescriptor);
+    throw std::runtime_error("system error - setsockopt(PACKET_VERSION) failed");
+  }
+
+  attachFilter(IpAddress, Port);
+
+  struct tpacket_req3 Request;
+  std::memset(&Request, 0, sizeof(Request));
+  Request.tp_block_size = BlockSize;
+  Request.tp_block_nr = NumBlocks;
+  Request.tp_frame_size = TPACKET_ALIGNMENT << 7; // only used for validation
+  Request.tp_frame_nr = (BlockSize / Request.tp_frame_size) * NumBlocks;
+  Request.tp_retire_blk_tov = BlockTimeoutMS;
+  if (setsockopt(SocketFileDescriptor, SOL_PACKET, PACKET_RX_RING, &Request,
+                 sizeof(Request)) < 0) {
+    close(SocketFileDescriptor);
+    throw std::runtime_error("system error - setsockopt(PACKET_RX_RING) failed");
+  }
+
+  RingSize = (size_t)BlockSize * NumBlocks;
+  void *Map = mmap(nullptr, RingSize, PROT_READ | PROT_WRITE,
+                   MAP_SHARED, SocketFileDescriptor, 0);
+  if (Map == MAP_FAILED) {
+    close(SocketFileDescriptor);
+    throw std::runtime_error("system error - mmap() of packet ring failed");
+  }
+  Ring = static_cast<uint8_t *>(Map);
+
+  struct sockaddr_ll Local;
+  std::memset(&Local, 0, sizeof(Local));
+  Local.sll_family = AF_PACKET;
+  Local.sll_protocol = htons(ETH_P_IP);
+  Local.sll_ifindex = if_nametoindex(Interface.c_str());
+  if (Local.sll_ifindex == 0 ||
+      bind(SocketFileDescriptor, (struct sockaddr *)&Local, sizeof(Local)) <
+          0) {
+    auto Msg = fmt::format("PacketMmapReceiver: bind to interface {} failed",
+                           Interface);
+    LOG(IPC, Sev::Error, Msg);
+    munmap(Ring, RingSize);
+    close(SocketFileDescriptor);
+    throw std::runtime_error(Msg);
+  }
+
+  LOG(IPC, Sev::Info,
+      "Packet mmap ring ({} blocks of {} bytes) bound to {} for {}:{}",
+      NumBlocks, BlockSize, Interface, IpAddress, Port);
+}
+
+PacketMmapReceiver::~PacketMmapReceiver() {
+  if (Ring != nullptr) {
+    munmap(Ring, RingSize);
+  }
+  if (SocketFileDescriptor >= 0) {
+    close(SocketFileDescriptor);
+  }
+}
+
+void PacketMmapReceiver::attachFilter(const std::string &IpAddress,
+                                      uint16_t Port) {
+  // Equivalent of 'udp dst port Port [and dst host IpAddress]' for IPv4 over
+  // Ethernet, not counting our own outgoing packets. Conditional jumps are
+  // relative, so drop targets are patched once the program length is known.
+  static constexpr uint8_t Drop{0xff};
+  std::vector<struct sock_filter> Code{
+      BPF_STMT(BPF_LD | BPF_B | BPF_ABS,
+               static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_PKTTYPE)),
+      BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, PACKET_OUTGOING, Drop, 0),
+      BPF_STMT(BPF_LD | BPF_H | BPF_ABS, 12),
+      BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ETH_P_IP, 0, Drop),
+      BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 23),
+      BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, IPPROTO_UDP, 0, Drop),
+      BPF_STMT(BPF_LD | BPF_H | BPF_ABS, 20),
+      BPF_JUMP(BPF_JMP | BPF_JSET | BPF_K, 0x1fff, Drop, 0)};
+
+  in_addr_t Address = inet_addr(IpAddress.c_str());
+  if (Address != INADDR_ANY) {
+    Code.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, 30));
+    Code.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ntohl(Address), 0, Drop));
+  }
+
+  Code.push_back(BPF_STMT(BPF_LDX | BPF_B | BPF_MSH, 14));
+  Code.push_back(BPF_STMT(BPF_LD | BPF_H | BPF_IND, 16));
+  Code.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, Port, 0, Drop));
+  Code.push_back(BPF_STMT(BPF_RET | BPF_K, 0x40000));
+  Code.push_back(BPF_STMT(BPF_RET | BPF_K, 0));
+
+  const size_t DropIndex = Code.size() - 1;
+  for (size_t i = 0; i < DropIndex; i++) {
+    if (Code[i].jt == Drop) {
+      Code[i].jt = DropIndex - i - 1;
+    }
+    if (Code[i].jf == Drop) {
+      Code[i].jf = DropIndex - i - 1;
+    }
+  }
+
+  struct sock_fprog Program;
+  Program.len = Code.size();
+  Program.filter = Code.data();
+  if (setsockopt(SocketFileDescriptor, SOL_SOCKET, SO_ATTACH_FILTER, &Program,
+                 sizeof(Program)) < 0) {
+    close(SocketFileDescriptor);
+    throw std::runtime_error("system error - setsockopt(SO_ATTACH_FILTER) failed");
+  }
+}
+
+bool PacketMmapReceiver::receive(char *&Data, int &Length, int TimeoutMS) {
+  while (true) {
+    if (PacketsLeft == 0) {
+      if (BlockOpen) { // current block fully read, move on
+        BlockOpen = false;
+        ReadSeq++;
+      }
+
+      // The next block is still held by the caller
+      if (ReadSeq - ReleaseSeq >= NumBlocks) {
+        return false;
+      }
+
+      auto Block = reinterpret_cast<struct tpacket_block_desc *>(
+          Ring + (ReadSeq % NumBlocks) * (size_t)BlockSize);
+      auto isUserBlock = [Block]() {
+        return (__atomic_load_n(&Block->hdr.bh1.block_status,
+                                __ATOMIC_ACQUIRE) &
+                TP_STATUS_USER) != 0;
+      };
+      auto Deadline = std::chrono::steady_clock::now() +
+                      std::chrono::milliseconds(TimeoutMS);
+      while (not isUserBlock()) {
+        int RemainingMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              Deadline - std::chrono::steady_clock::now())
+                              .count();
+        if (RemainingMS <= 0) {
+          return false;
+        }
+        struct pollfd PollFd {SocketFileDescriptor, POLLIN | POLLERR, 0};
+        if (poll(&PollFd, 1, RemainingMS) > 0 and not isUserBlock()) {
+          // poll() also reports the previous block while the caller still
+          // holds it. The kernel retires a partially filled block after
+          // BlockTimeoutMS, so wait that long before polling again
+          poll(nullptr, 0, std::min(BlockTimeoutMS, RemainingMS));
+        }
+      }
+
+      BlockOpen = true;
+      PacketsLeft = Block->hdr.bh1.num_pkts;
+      NextPacket = reinterpret_cast<uint8_t *>(Block) +
+                   Block->hdr.bh1.offset_to_first_pkt;
+      XTRACE(INPUT, DEB, "Block %" PRIu64 " has %u packets", ReadSeq,
+             PacketsLeft);
+      continue;
+    }
+
+    auto Header = reinterpret_cast<struct tpacket3_hdr *>(NextPacket);
+    NextPacket += Header->tp_next_offset;
+    PacketsLeft--;
+
+    // The BPF filter guarantees Ethernet/IPv4/UDP
+    uint8_t *Frame = reinterpret_cast<uint8_t *>(Header) + Header->tp_mac;
+    auto IpHeader = reinterpret_cast<struct iphdr *>(Frame + ETH_HLEN);
+    auto UdpHeader = reinterpret_cast<struct udphdr *>(
+        reinterpret_cast<uint8_t *>(IpHeader) + IpHeader->ihl * 4);
+    int UdpLength = ntohs(UdpHeader->len) - sizeof(struct udphdr);
+    uint8_t *Payload =
+        reinterpret_cast<uint8_t *>(UdpHeader) + sizeof(struct udphdr);
+
+    // Skip truncated frames, reported as drops by readStatistics()
+    if (UdpLength <= 0 || Payload + UdpLength > Frame + Header->tp_snaplen) {
+      SkippedFrames++;
+      continue;
+    }
+
+    Data = reinterpret_cast<char *>(Payload);
+    Length = UdpLength;
+    return true;
+  }
+}
+
+void PacketMmapReceiver::holdCurrentBlock(uint64_t Tag) {
+  BlockHold[ReadSeq % NumBlocks] = Tag;
+}
+
+void PacketMmapReceiver::releaseBlocks(uint64_t Done) {
+  while (ReleaseSeq < ReadSeq) {
+    auto Index = ReleaseSeq % NumBlocks;
+    if (BlockHold[Index] > Done) {
+      return;
+    }
+    auto Block = reinterpret_cast<struct tpacket_block_desc *>(
+        Ring + Index * (size_t)BlockSize);
+    __atomic_store_n(&Block->hdr.bh1.block_status, TP_STATUS_KERNEL,
+                     __ATOMIC_RELEASE);
+    BlockHold[Index] = 0;
+    ReleaseSeq++;
+  }
+}
+
+void PacketMmapReceiver::readStatistics(uint64_t &Packets, uint64_t &Drops) {
+  struct tpacket_stats_v3 Stats;
+  socklen_t Length = sizeof(Stats);
+  Packets = 0;
+  Drops = 0;
+  if (getsockopt(SocketFileDescriptor, SOL_PACKET, PACKET_STATISTICS, &Stats,
+                 &Length) == 0) {
+    Packets = Stats.tp_packets;
+    Drops = Stats.tp_drops + SkippedFrames;
+    SkippedFrames = 0;
+  }
+}
+
+#else
+
+PacketMmapReceiver::PacketMmapReceiver(const std::string &, const std::string &,
+                                       uint16_t, uint32_t, uint32_t,
+                                       uint32_t) {
+  throw std::runtime_error("PacketMmapReceiver is only supported on Linux");
+}
+
+PacketMmapReceiver::~PacketMmapReceiver() {}
+
+void PacketMmapReceiver::attachFilter(const std::string &, uint16_t) {}
+
+bool PacketMmapReceiver::receive(char *&, int &, int) { return false; }
+
+void PacketMmapReceiver::holdCurrentBlock(uint64_t) {}
+
+void PacketMmapReceiver::releaseBlocks(uint64_t) {}
+
+void PacketMmapReceiver::readStatistics(uint64_t &Packets, uint64_t &Drops) {
+  Packets = 0;
+  Drops = 0;
+}
+
+#endif
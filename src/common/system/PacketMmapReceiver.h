@@ -0,0 +1,98 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief Zero copy UDP receiver based on a memory mapped AF_PACKET
+/// (TPACKET_V3) receive ring
+///
+/// The kernel writes received frames into blocks of a ring shared with user
+/// space. UDP payloads are handed out as pointers into these blocks, so no
+/// copy into a user buffer is needed. A block stays owned by user space
+/// until it has been read to the end and every packet kept from it has been
+/// released by the caller, see holdCurrentBlock() and releaseBlocks().
+///
+/// Only matching IPv4/UDP packets (destination port and optionally address)
+/// are accepted, using a classic BPF socket filter, so the kernel ring
+/// statistics only count detector data. Requires CAP_NET_RAW. Linux only.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <common/system/SocketInterface.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class PacketMmapReceiver : public SocketInterface {
+public:
+  /// \brief Create AF_PACKET socket with TPACKET_V3 receive ring and bind it
+  /// to a network interface
+  /// \param Interface name of network interface, for example "eth0"
+  /// \param IpAddress destination address to accept, "0.0.0.0" for any
+  /// \param Port destination UDP port to accept
+  /// \param BlockSize size of each ring block (multiple of page size)
+  /// \param NumBlocks number of blocks in the ring
+  /// \param BlockTimeoutMS time before the kernel retires a partially filled
+  /// block to user space
+  PacketMmapReceiver(const std::string &Interface, const std::string &IpAddress,
+                     uint16_t Port, uint32_t BlockSize = 1 << 20,
+                     uint32_t NumBlocks = 64, uint32_t BlockTimeoutMS = 1);
+
+  /// \brief Unmap ring and close socket
+  ~PacketMmapReceiver();
+
+  PacketMmapReceiver(const PacketMmapReceiver &) = delete;
+  PacketMmapReceiver &operator=(const PacketMmapReceiver &) = delete;
+
+  /// \brief This is a receive only socket, always fails
+  int send(void const *dataBuffer, int dataLength) override;
+
+  /// \brief Get the UDP payload of the next packet in the ring
+  /// \param Data set to point to the payload inside the ring
+  /// \param Length set to the length of the payload
+  /// \param TimeoutMS time to wait for the kernel to hand over a block
+  /// \return true if a packet was returned, false on timeout or if all
+  /// blocks are still held by the caller
+  bool receive(char *&Data, int &Length, int TimeoutMS);
+
+  /// \brief Keep the block of the most recently received packet until
+  /// releaseBlocks() is called with a value >= Tag
+  void holdCurrentBlock(uint64_t Tag);
+
+  /// \brief Return fully read blocks to the kernel, in ring order, as long
+  /// as their hold tag is <= Done
+  void releaseBlocks(uint64_t Done);
+
+  /// \brief Read (and reset) the kernel ring statistics
+  /// \param Packets packets that matched the filter, including drops
+  /// \param Drops packets dropped because no block was free, and truncated
+  /// or malformed frames skipped by receive(), so that Packets - Drops is
+  /// the number of packets returned by receive()
+  void readStatistics(uint64_t &Packets, uint64_t &Drops);
+
+  /// \brief number of blocks currently owned by user space
+  uint64_t blocksInUse() const { return ReadSeq - ReleaseSeq; }
+
+private:
+  /// \brief attach BPF program accepting IPv4/UDP to Port (and IpAddress)
+  void attachFilter(const std::string &IpAddress, uint16_t Port);
+
+  int SocketFileDescriptor{-1};
+  uint8_t *Ring{nullptr};
+  size_t RingSize{0};
+  uint32_t BlockSize{0};
+  uint32_t NumBlocks{0};
+  int BlockTimeoutMS{1};
+
+  /// Per block tag, block is released when caller is done up to the tag
+  std::vector<uint64_t> BlockHold;
+
+  uint64_t ReadSeq{0};    ///< block currently being read
+  uint64_t ReleaseSeq{0}; ///< oldest block not yet returned to kernel
+  bool BlockOpen{false};  ///< ReadSeq block handed over by kernel
+  uint32_t PacketsLeft{0};
+  uint8_t *NextPacket{nullptr};
+
+  /// Frames counted by the kernel but not returned, since readStatistics()
+  uint64_t SkippedFrames{0};
+};
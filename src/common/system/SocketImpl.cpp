@@ -91,6 +91,15 @@ void SocketImpl::setMulticastReceive() {
   }
 }
 
+void SocketImpl::setReusePort() {
+  if ((setsockopt(SocketFileDescriptor, SOL_SOCKET, SO_REUSEPORT,
+                  &SockOptFlagOn, sizeof(SockOptFlagOn))) < 0) {
+    LOG(IPC, Sev::Error, "setsockopt(SOL_SOCKET, SO_REUSEPORT) failed");
+    throw std::runtime_error(
+        "system error - setsockopt(SOL_SOCKET, SO_REUSEPORT) failed");
+  }
+}
+
 int SocketImpl::setBufferSizes(int sndbuf, int rcvbuf) {
   if (sndbuf) {
     setSockOpt(SO_SNDBUF, &sndbuf, sizeof(sndbuf));
@@ -240,6 +249,43 @@ ssize_t SocketImpl::receive(void *buffer, int buflen) {
                   (struct sockaddr *)&remoteSockAddr, &slen);
 }
 
+int SocketImpl::receiveBatch(char *const *Buffers, int BufferSize,
+                             int *Lengths, int NumBuffers) {
+#ifdef __linux__
+  if (BatchHeaders.size() < (size_t)NumBuffers) {
+    BatchHeaders.resize(NumBuffers);
+    BatchVectors.resize(NumBuffers);
+  }
+
+  for (int i = 0; i < NumBuffers; i++) {
+    BatchVectors[i].iov_base = Buffers[i];
+    BatchVectors[i].iov_len = BufferSize;
+    std::memset(&BatchHeaders[i], 0, sizeof(struct mmsghdr));
+    BatchHeaders[i].msg_hdr.msg_iov = &BatchVectors[i];
+    BatchHeaders[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  // MSG_WAITFORONE: block for the first datagram only, then drain what is
+  // already queued without waiting
+  int Received = recvmmsg(SocketFileDescriptor, BatchHeaders.data(),
+                          NumBuffers, MSG_WAITFORONE, nullptr);
+  for (int i = 0; i < Received; i++) {
+    Lengths[i] = BatchHeaders[i].msg_len;
+  }
+  return Received;
+#else
+  if (NumBuffers < 1) {
+    return 0;
+  }
+  ssize_t ReadSize = receive(Buffers[0], BufferSize);
+  if (ReadSize <= 0) {
+    return ReadSize;
+  }
+  Lengths[0] = ReadSize;
+  return 1;
+#endif
+}
+
 //
 // Private methods
 //
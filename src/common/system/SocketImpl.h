@@ -18,6 +18,7 @@
 #include <string>
 #include <sys/socket.h>
 #include <unistd.h>
+#include <vector>
 #include <common/system/SocketInterface.h>
 
 /// BSD Socket abstractions for TCP and UDP transmitters and receivers
@@ -60,6 +61,10 @@ public:
   // void setMulticastReceive(const std::string &MultiCastAddress);
   void setMulticastReceive();
 
+  /// Allow several sockets to bind to the same ip and port, the kernel then
+  /// distributes incoming flows across them. Must be called before bind
+  void setReusePort();
+
   /// Attempt to specify the socket receive and transmit buffer sizes (for
   /// performance)
   int setBufferSizes(int sndbuf, int rcvbuf);
@@ -93,6 +98,18 @@ public:
   /// Receive data on socket into buffer with specified length
   ssize_t receive(void *receiveBuffer, int bufferSize);
 
+  /// \brief Receive up to NumBuffers datagrams with a single system call
+  /// (recvmmsg() on Linux, a single recvfrom() elsewhere). Blocks (subject to
+  /// the receive timeout) until the first datagram arrives, then returns
+  /// whatever else is already queued on the socket.
+  /// \param Buffers array of NumBuffers pointers to receive buffers
+  /// \param BufferSize size of each receive buffer (bytes)
+  /// \param Lengths array of NumBuffers, filled with the received sizes
+  /// \param NumBuffers maximum number of datagrams to receive
+  /// \return number of datagrams received, or <= 0 on timeout/error
+  int receiveBatch(char *const *Buffers, int BufferSize, int *Lengths,
+                   int NumBuffers);
+
   /// Send data in buffer with specified length
   int send(void const *dataBuffer, int dataLength);
 
@@ -114,6 +131,12 @@ private:
   struct sockaddr_in remoteSockAddr;
   struct sockaddr_in localSockAddr;
 
+#ifdef __linux__
+  /// message headers and io vectors reused by receiveBatch()
+  std::vector<struct mmsghdr> BatchHeaders;
+  std::vector<struct iovec> BatchVectors;
+#endif
+
   /// wrapper for getsockopt() system call
   int getSockOpt(int option);
 
@@ -124,7 +147,11 @@ private:
 /// UDP receiver only needs to specify local socket
 class UDPReceiver : public SocketImpl {
 public:
-  UDPReceiver(Endpoint Local) : SocketImpl(SocketImpl::SocketType::UDP) {
+  UDPReceiver(Endpoint Local, bool ReusePort = false)
+      : SocketImpl(SocketImpl::SocketType::UDP) {
+    if (ReusePort) {
+      this->setReusePort();
+    }
     this->setLocalSocket(Local.IpAddress, Local.Port);
   };
 };
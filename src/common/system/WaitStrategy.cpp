@@ -0,0 +1,65 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Implementation of the processing thread idle wait
+///
+//===----------------------------------------------------------------------===//
+
+#include <common/system/WaitStrategy.h>
+#include <chrono>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+WaitStrategy::Mode WaitStrategy::modeFromString(const std::string &Name) {
+  if (Name == "sleep") {
+    return Mode::Sleep;
+  }
+  if (Name == "spin") {
+    return Mode::Spin;
+  }
+  if (Name == "adaptive") {
+    return Mode::Adaptive;
+  }
+  throw std::runtime_error("Unknown wait strategy: " + Name);
+}
+
+#ifdef __linux__
+
+void WaitStrategy::block() {
+  struct timespec Timeout;
+  Timeout.tv_sec = BlockTimeoutUS / 1000000;
+  Timeout.tv_nsec = (BlockTimeoutUS % 1000000) * 1000;
+  // Returns immediately if Sleeping has already been cleared by wake()
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&Sleeping),
+          FUTEX_WAIT_PRIVATE, 1, &Timeout, nullptr, 0);
+}
+
+void WaitStrategy::wake() {
+  Sleeping.store(0, std::memory_order_relaxed);
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&Sleeping),
+          FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+
+#else
+
+// No futex, fall back to short sleeps while Sleeping is set
+void WaitStrategy::block() {
+  auto Deadline = std::chrono::steady_clock::now() +
+                  std::chrono::microseconds(BlockTimeoutUS);
+  while (Sleeping.load(std::memory_order_relaxed) and
+         std::chrono::steady_clock::now() < Deadline) {
+    std::this_thread::sleep_for(std::chrono::microseconds(20));
+  }
+}
+
+void WaitStrategy::wake() { Sleeping.store(0, std::memory_order_relaxed); }
+
+#endif
@@ -0,0 +1,110 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Idle wait for processing threads waiting for input data
+///
+/// Modes
+///  - sleep: sleep a fixed 100us (previous behaviour)
+///  - spin: busy wait, then yield, never block. Lowest latency, but keeps
+///    a core busy
+///  - adaptive: busy wait, then yield, then block (futex on Linux) until
+///    notify() is called or a timeout expires
+///
+/// In adaptive mode the producer must call notify() after each push. This
+/// is a fence and a load unless the consumer is actually blocked.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+class WaitStrategy {
+public:
+  enum class Mode { Sleep, Spin, Adaptive };
+
+  /// \brief convert "sleep", "spin" or "adaptive" to Mode
+  /// \throws std::runtime_error for unknown names
+  static Mode modeFromString(const std::string &Name);
+
+  /// \param WaitMode see above
+  /// \param BlockTimeoutUS max time blocked in adaptive mode, so callers
+  /// still get to do periodic housekeeping when no data arrives
+  WaitStrategy(Mode WaitMode = Mode::Adaptive, uint32_t BlockTimeoutUS = 1000)
+      : WaitMode(WaitMode), BlockTimeoutUS(BlockTimeoutUS) {}
+
+  /// \brief Consumer side, wait until DataAvailable() returns true or
+  /// the mode specific wait has expired
+  template <typename Predicate> void wait(Predicate DataAvailable) {
+    if (WaitMode == Mode::Sleep) {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      return;
+    }
+
+    for (int i = 0; i < SpinCount; i++) {
+      if (DataAvailable()) {
+        return;
+      }
+      cpuRelax();
+    }
+    for (int i = 0; i < YieldCount; i++) {
+      if (DataAvailable()) {
+        return;
+      }
+      std::this_thread::yield();
+    }
+    if (WaitMode == Mode::Spin) {
+      return;
+    }
+
+    // Announce that we are about to block, then check again so that a
+    // push made before the announcement is not missed
+    Sleeping.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (not DataAvailable()) {
+      block();
+    }
+    Sleeping.store(0, std::memory_order_relaxed);
+  }
+
+  /// \brief Producer side, wake a blocked consumer. Call after push
+  void notify() {
+    if (WaitMode != Mode::Adaptive) {
+      return;
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (Sleeping.load(std::memory_order_relaxed)) {
+      wake();
+    }
+  }
+
+  Mode getMode() const { return WaitMode; }
+
+private:
+  static constexpr int SpinCount{2000};
+  static constexpr int YieldCount{20};
+
+  static inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+  /// \brief block while Sleeping is set, at most BlockTimeoutUS
+  void block();
+
+  /// \brief clear Sleeping and wake the blocked consumer
+  void wake();
+
+  Mode WaitMode;
+  uint32_t BlockTimeoutUS;
+
+  alignas(64) std::atomic<uint32_t> Sleeping{0};
+};
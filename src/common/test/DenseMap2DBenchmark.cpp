@@ -0,0 +1,99 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief HashMap2D versus DenseMap2D for the per readout lookups of the CBM
+/// module
+///
+/// A stream of IBM readouts for the three IBM monitors of the cbmtest.json
+/// configuration (FEN/Channel 1/1, 1/2 and 2/1, MaxFENId 2). For each
+/// readout the topology is checked (isValue) and the serializer is found
+/// (get), as in CbmInstrument::processMonitorReadouts()
+
+#include <benchmark/benchmark.h>
+#include <common/memory/DenseMap2D.h>
+#include <common/memory/HashMap2D.h>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+static constexpr int NumOfFENs{3};
+static constexpr size_t Readouts{9000};
+
+struct Monitor {
+  int FEN;
+  int Channel;
+  int Serializer;
+};
+
+static const std::vector<Monitor> Monitors{{1, 1, 0}, {1, 2, 1}, {2, 1, 2}};
+
+struct Readout {
+  uint8_t FENId;
+  uint8_t Channel;
+};
+
+static std::vector<Readout> makeReadouts() {
+  std::mt19937 Random(42);
+  std::uniform_int_distribution<size_t> Index(0, Monitors.size() - 1);
+  std::vector<Readout> Data;
+  for (size_t i = 0; i < Readouts; i++) {
+    const Monitor &M = Monitors[Index(Random)];
+    Data.push_back({uint8_t(M.FEN), uint8_t(M.Channel)});
+  }
+  return Data;
+}
+
+template <typename MapType> static void addMonitors(MapType &Map) {
+  for (auto &M : Monitors) {
+    auto Value = std::make_unique<int>(M.Serializer);
+    Map.add(M.FEN, M.Channel, Value);
+  }
+}
+
+static void HashMap2DLookup(benchmark::State &state) {
+  HashMap2D<int> Map(NumOfFENs);
+  addMonitors(Map);
+  auto Data = makeReadouts();
+
+  for (auto _ : state) {
+    int64_t Sum{0};
+    for (auto &R : Data) {
+      if (not Map.isValue(R.FENId, R.Channel)) {
+        continue;
+      }
+      try {
+        Sum += *Map.get(R.FENId, R.Channel);
+      } catch (std::out_of_range &e) {
+        continue;
+      }
+    }
+    benchmark::DoNotOptimize(Sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(HashMap2DLookup);
+
+static void DenseMap2DLookup(benchmark::State &state) {
+  DenseMap2D<int> Map(NumOfFENs);
+  addMonitors(Map);
+  auto Data = makeReadouts();
+
+  for (auto _ : state) {
+    int64_t Sum{0};
+    for (auto &R : Data) {
+      if (not Map.isValue(R.FENId, R.Channel)) {
+        continue;
+      }
+      const int *Serializer = Map.get(R.FENId, R.Channel);
+      if (Serializer == nullptr) {
+        continue;
+      }
+      Sum += *Serializer;
+    }
+    benchmark::DoNotOptimize(Sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(DenseMap2DLookup);
+
+BENCHMARK_MAIN();
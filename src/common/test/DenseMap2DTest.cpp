@@ -0,0 +1,82 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Unit tests for DenseMap2D
+//===----------------------------------------------------------------------===//
+
+#include <common/memory/DenseMap2D.h>
+#include <common/testutils/TestBase.h>
+
+class DenseMap2DTest : public TestBase {
+protected:
+  DenseMap2D<int> Map{4};
+
+  void add(int Col, int Row, int Value) {
+    auto Ptr = std::make_unique<int>(Value);
+    Map.add(Col, Row, Ptr);
+  }
+};
+
+TEST_F(DenseMap2DTest, Empty) {
+  ASSERT_TRUE(Map.isEmpty());
+  ASSERT_FALSE(Map.isValue(0, 0));
+  ASSERT_EQ(Map.get(0, 0), nullptr);
+  ASSERT_TRUE(Map.toValuesList().empty());
+}
+
+TEST_F(DenseMap2DTest, AddAndGet) {
+  add(1, 0, 10);
+  add(3, 5, 35);
+
+  ASSERT_FALSE(Map.isEmpty());
+  ASSERT_TRUE(Map.isValue(1, 0));
+  ASSERT_TRUE(Map.isValue(3, 5));
+  ASSERT_EQ(*Map.get(1, 0), 10);
+  ASSERT_EQ(*Map.get(3, 5), 35);
+
+  ASSERT_FALSE(Map.isValue(0, 0));
+  ASSERT_FALSE(Map.isValue(3, 4));
+  ASSERT_EQ(Map.get(2, 2), nullptr);
+
+  ASSERT_EQ(Map.toValuesList().size(), 2);
+  ASSERT_EQ(*Map.toValuesList()[0], 10);
+  ASSERT_EQ(*Map.toValuesList()[1], 35);
+}
+
+TEST_F(DenseMap2DTest, OutOfRangeGet) {
+  add(3, 0, 3);
+  add(0, 1, 4);
+
+  // (4, 0) would share the index of (0, 1)
+  ASSERT_EQ(Map.get(4, 0), nullptr);
+  ASSERT_EQ(Map.get(-1, 1), nullptr);
+  ASSERT_EQ(Map.get(0, -1), nullptr);
+  ASSERT_EQ(Map.get(0, 200), nullptr);
+  ASSERT_EQ(Map.get(255, 255), nullptr);
+}
+
+TEST_F(DenseMap2DTest, OutOfRangeAdd) {
+  auto Ptr = std::make_unique<int>(1);
+  ASSERT_THROW(Map.add(4, 0, Ptr), std::out_of_range);
+  ASSERT_THROW(Map.add(-1, 0, Ptr), std::out_of_range);
+  ASSERT_THROW(Map.add(0, -1, Ptr), std::out_of_range);
+  ASSERT_NE(Ptr, nullptr);
+  ASSERT_TRUE(Map.isEmpty());
+}
+
+TEST_F(DenseMap2DTest, DuplicateKeepsFirst) {
+  add(2, 2, 1);
+  auto Ptr = std::make_unique<int>(2);
+  Map.add(2, 2, Ptr);
+
+  ASSERT_NE(Ptr, nullptr);
+  ASSERT_EQ(*Map.get(2, 2), 1);
+  ASSERT_EQ(Map.toValuesList().size(), 1);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -77,7 +77,7 @@ public:
 
   /// \brief Public wrapper to test topology validation
   template <typename T>
-  bool testValidateTopology(HashMap2D<T> &map, int Col, int Row) const {
+  bool testValidateTopology(DenseMap2D<T> &map, int Col, int Row) const {
     return validateTopology(map, Col, Row);
   }
 };
@@ -55,7 +55,7 @@ TEST_F(DetectorTest, TestConstructorAndStatCreation) {
   // Get the total number of stats
   int statSize = DetectorPtr->statsize();
   // Update this in case of new counters introduced for detector class
-  constexpr int ExpectedStatCount = 72;
+  constexpr int ExpectedStatCount = 77;
   EXPECT_EQ(statSize, ExpectedStatCount);
 
   // Test invalid stat indices
@@ -73,6 +73,47 @@ TEST_F(DetectorTest, ThreadInfoNoThreads) {
   ASSERT_EQ(0, threadlist.size());
 }
 
+TEST_F(DetectorTest, InputThreadsPerQueue) {
+  Settings.RxThreads = 3;
+  Detector Base(Settings);
+  ASSERT_EQ(Base.InputQueues.size(), 3);
+  ASSERT_EQ(&Base.InputFifo, &Base.InputQueues[0]->Fifo);
+
+  Base.addInputThreads();
+  auto &threadlist = Base.GetThreadInfo();
+  ASSERT_EQ(threadlist.size(), 4);
+  ASSERT_EQ(threadlist[0].name, "input");
+  ASSERT_EQ(threadlist[2].name, "input_2");
+  ASSERT_EQ(threadlist[3].name, "monitor");
+}
+
+TEST_F(DetectorTest, PacketMmapUsesSingleQueue) {
+  Settings.RxThreads = 3;
+  Settings.RxBackend = "packet_mmap";
+  Detector Base(Settings);
+  ASSERT_EQ(Base.InputQueues.size(), 1);
+}
+
+TEST_F(DetectorTest, PopInputRoundRobin) {
+  Settings.RxThreads = 2;
+  Detector Base(Settings);
+  unsigned int DataIndex;
+  ASSERT_EQ(Base.popInput(DataIndex), nullptr);
+
+  // Two entries in the first queue, one in the second
+  ASSERT_TRUE(Base.InputQueues[0]->Fifo.push(10));
+  ASSERT_TRUE(Base.InputQueues[0]->Fifo.push(11));
+  ASSERT_TRUE(Base.InputQueues[1]->Fifo.push(20));
+
+  ASSERT_EQ(Base.popInput(DataIndex), &Base.InputQueues[0]->Ring);
+  ASSERT_EQ(DataIndex, 10);
+  ASSERT_EQ(Base.popInput(DataIndex), &Base.InputQueues[1]->Ring);
+  ASSERT_EQ(DataIndex, 20);
+  ASSERT_EQ(Base.popInput(DataIndex), &Base.InputQueues[0]->Ring);
+  ASSERT_EQ(DataIndex, 11);
+  ASSERT_EQ(Base.popInput(DataIndex), nullptr);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,73 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief TOF calculation per readout versus for a batch of readouts
+///
+/// Event times are spread over the 14Hz pulse period, so some fall before
+/// the reference time and use the previous pulse time.
+
+#include <benchmark/benchmark.h>
+#include <common/Statistics.h>
+#include <common/time/ESSTime.h>
+#include <random>
+#include <vector>
+
+using namespace esstime;
+
+static constexpr size_t Readouts{1000};
+static constexpr uint32_t PulseTicks{6289464}; // 14 Hz
+
+struct EventTimes {
+  std::vector<uint32_t> High;
+  std::vector<uint32_t> Low;
+
+  EventTimes() {
+    std::mt19937 Random(42);
+    std::uniform_int_distribution<uint32_t> Ticks(0, 2 * PulseTicks);
+    for (size_t i = 0; i < Readouts; i++) {
+      High.push_back(1000);
+      Low.push_back(Ticks(Random));
+    }
+  }
+};
+
+static void setPulseTimes(ESSReferenceTime &Time) {
+  Time.setReference(ESSTime(1000, PulseTicks));
+  Time.setPrevReference(ESSTime(1000, 0));
+}
+
+static void ScalarTOF(benchmark::State &state) {
+  EventTimes Events;
+  Statistics Stats;
+  ESSReferenceTime Time(Stats);
+  setPulseTimes(Time);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < Readouts; i++) {
+      auto TOF = Time.getTOF(ESSTime(Events.High[i], Events.Low[i]));
+      benchmark::DoNotOptimize(TOF);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(ScalarTOF);
+
+static void BatchTOF(benchmark::State &state) {
+  EventTimes Events;
+  Statistics Stats;
+  ESSReferenceTime Time(Stats);
+  setPulseTimes(Time);
+  std::vector<uint64_t> TOF(Readouts);
+  std::vector<uint8_t> Valid(Readouts);
+
+  for (auto _ : state) {
+    auto Good = Time.getTOFs(Events.High.data(), Events.Low.data(), Readouts,
+                             TOF.data(), Valid.data());
+    benchmark::DoNotOptimize(Good);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(BatchTOF);
+
+BENCHMARK_MAIN();
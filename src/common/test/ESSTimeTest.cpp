@@ -11,6 +11,7 @@
 #include <common/testutils/TestBase.h>
 #include <common/time/ESSTime.h>
 #include <cstdint>
+#include <vector>
 
 using namespace esstime;
 
@@ -412,6 +413,62 @@ TEST_F(ESSTimeTest, ExactPulseDelay) {
   ASSERT_EQ(Time.getRefTimeUInt64() - Time.getPrevRefTimeUInt64(), 71428568);
 }
 
+TEST_F(ESSTimeTest, TicksToNSSameAsToNS) {
+  for (uint32_t Low = 0; Low < 1000000; Low++) {
+    ASSERT_EQ(ESSTime::ticksToNS(Low), ESSTime::toNS(0, Low).count());
+  }
+  for (uint32_t Low = 88052500 - 1000000; Low < 88052500 + 1000000; Low++) {
+    ASSERT_EQ(ESSTime::ticksToNS(Low), ESSTime::toNS(0, Low).count());
+  }
+  uint32_t Low = ESSTime::MaxFixedPointTicks;
+  ASSERT_EQ(ESSTime::ticksToNS(Low), ESSTime::toNS(0, Low).count());
+}
+
+TEST_F(ESSTimeTest, BatchTOFSameAsScalar) {
+  Statistics ScalarStats;
+  ESSReferenceTime ScalarTime(ScalarStats);
+  for (auto *RefTime : {&Time, &ScalarTime}) {
+    RefTime->setReference(ESSTime(100, 100000));
+    RefTime->setPrevReference(ESSTime(99, 50000));
+    RefTime->setMaxTOF(40000000);
+  }
+
+  // TOF, prev TOF, prev TOF negative, TOF too high, prev TOF too high,
+  // TimeLow larger than a second
+  std::vector<uint32_t> High{100, 99, 99, 99, 100, 100, 100, 100, 101, 100};
+  std::vector<uint32_t> Low{100000,  60000,   50000,      0,
+                            3622100, 3622000, 75000,      0xFFFFFFFF,
+                            0,       200000};
+  std::vector<uint64_t> TOF(High.size());
+  std::vector<uint8_t> Valid(High.size());
+
+  size_t Good = Time.getTOFs(High.data(), Low.data(), High.size(), TOF.data(),
+                             Valid.data(), 7);
+
+  size_t ScalarGood{0};
+  for (size_t i = 0; i < High.size(); i++) {
+    auto Tof = ScalarTime.getTOF(ESSTime(High[i], Low[i]), 7);
+    ASSERT_EQ(Valid[i], Tof.has_value()) << "index " << i;
+    ASSERT_EQ(TOF[i], Tof.value_or(0)) << "index " << i;
+    ScalarGood += Tof.has_value();
+  }
+  ASSERT_EQ(Good, ScalarGood);
+  ASSERT_EQ(Good, 5);
+  ASSERT_EQ(Time.Counters.PrevTofHigh, 1);
+  ASSERT_EQ(Time.Counters.TofCount, ScalarTime.Counters.TofCount);
+  ASSERT_EQ(Time.Counters.TofNegative, ScalarTime.Counters.TofNegative);
+  ASSERT_EQ(Time.Counters.TofHigh, ScalarTime.Counters.TofHigh);
+  ASSERT_EQ(Time.Counters.PrevTofCount, ScalarTime.Counters.PrevTofCount);
+  ASSERT_EQ(Time.Counters.PrevTofNegative,
+            ScalarTime.Counters.PrevTofNegative);
+  ASSERT_EQ(Time.Counters.PrevTofHigh, ScalarTime.Counters.PrevTofHigh);
+}
+
+TEST_F(ESSTimeTest, BatchTOFEmpty) {
+  ASSERT_EQ(Time.getTOFs(nullptr, nullptr, 0, nullptr, nullptr), 0);
+  ASSERT_EQ(Time.Counters.TofCount, 0);
+}
+
 // Test specific error condition
 TEST_F(ESSTimeTest, Issue2021_11_08) {
   Time.setReference(ESSTime(0x6188e7a9, 0x00070ff6));
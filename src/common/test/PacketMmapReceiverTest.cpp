@@ -0,0 +1,143 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Unit test for the memory mapped AF_PACKET receiver. Needs
+/// CAP_NET_RAW, tests are skipped if the ring cannot be created.
+///
+//===----------------------------------------------------------------------===//
+
+#include <common/system/PacketMmapReceiver.h>
+#include <common/system/SocketImpl.h>
+#include <common/testutils/TestBase.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <memory>
+
+class PacketMmapReceiverTest : public TestBase {
+protected:
+  static constexpr uint16_t TestPort{9741};
+  std::unique_ptr<PacketMmapReceiver> Receiver;
+
+  void SetUp() override {
+    try {
+      Receiver = std::make_unique<PacketMmapReceiver>("lo", "127.0.0.1",
+                                                      TestPort, 1 << 16, 4);
+    } catch (std::runtime_error &) {
+      GTEST_SKIP() << "Unable to create packet ring (no CAP_NET_RAW?)";
+    }
+  }
+
+  void sendPackets(uint16_t Port, std::vector<int> Sizes) {
+    SocketImpl::Endpoint Local("0.0.0.0", 0);
+    SocketImpl::Endpoint Remote("127.0.0.1", Port);
+    UDPTransmitter Transmitter(Local, Remote);
+    char Buffer[1000];
+    for (auto Size : Sizes) {
+      memset(Buffer, Size & 0xff, Size);
+      ASSERT_EQ(Transmitter.send(Buffer, Size), Size);
+    }
+  }
+};
+
+TEST_F(PacketMmapReceiverTest, SendIsNotSupported) {
+  char Buffer[10];
+  ASSERT_EQ(Receiver->send(Buffer, 10), -1);
+}
+
+TEST_F(PacketMmapReceiverTest, ReceiveMatchingPackets) {
+  sendPackets(TestPort + 1, {50});
+  sendPackets(TestPort, {100, 200, 300});
+
+  char *Data;
+  int Length;
+  std::vector<int> Lengths;
+  for (int i = 0; i < 100 && Lengths.size() < 3; i++) {
+    if (Receiver->receive(Data, Length, 10)) {
+      ASSERT_EQ((uint8_t)Data[0], Length & 0xff);
+      Lengths.push_back(Length);
+    }
+  }
+  ASSERT_EQ(Lengths, std::vector<int>({100, 200, 300}));
+
+  // the packet to another port is filtered by the kernel
+  ASSERT_FALSE(Receiver->receive(Data, Length, 10));
+
+  uint64_t Packets, Drops;
+  Receiver->readStatistics(Packets, Drops);
+  ASSERT_EQ(Packets, 3);
+  ASSERT_EQ(Drops, 0);
+}
+
+// A UDP length beyond the end of the frame is skipped and counted as drop
+TEST_F(PacketMmapReceiverTest, MalformedFramesAreDrops) {
+  int RawSocket = socket(AF_INET, SOCK_RAW, IPPROTO_UDP);
+  ASSERT_GE(RawSocket, 0);
+  uint8_t Buffer[sizeof(struct udphdr) + 20]{};
+  auto Udp = reinterpret_cast<struct udphdr *>(Buffer);
+  Udp->source = htons(TestPort + 2);
+  Udp->dest = htons(TestPort);
+  Udp->len = htons(sizeof(struct udphdr) + 100);
+  struct sockaddr_in Remote {};
+  Remote.sin_family = AF_INET;
+  Remote.sin_addr.s_addr = inet_addr("127.0.0.1");
+  ASSERT_EQ(sendto(RawSocket, Buffer, sizeof(Buffer), 0,
+                   (struct sockaddr *)&Remote, sizeof(Remote)),
+            (ssize_t)sizeof(Buffer));
+  close(RawSocket);
+  sendPackets(TestPort, {100});
+
+  char *Data;
+  int Length;
+  std::vector<int> Lengths;
+  for (int i = 0; i < 100 && Lengths.empty(); i++) {
+    if (Receiver->receive(Data, Length, 10)) {
+      Lengths.push_back(Length);
+    }
+  }
+  ASSERT_EQ(Lengths, std::vector<int>({100}));
+  ASSERT_FALSE(Receiver->receive(Data, Length, 10));
+
+  uint64_t Packets, Drops;
+  Receiver->readStatistics(Packets, Drops);
+  ASSERT_EQ(Packets, 2);
+  ASSERT_EQ(Drops, 1);
+  Receiver->readStatistics(Packets, Drops);
+  ASSERT_EQ(Drops, 0);
+}
+
+TEST_F(PacketMmapReceiverTest, HeldBlocksAreNotReused) {
+  char *Data;
+  int Length;
+  for (int Block = 0; Block < 4; Block++) {
+    sendPackets(TestPort, {100});
+    bool Received{false};
+    for (int i = 0; i < 100 && !Received; i++) {
+      Received = Receiver->receive(Data, Length, 10);
+    }
+    ASSERT_TRUE(Received) << Block;
+    Receiver->holdCurrentBlock(Block + 1);
+    // let the kernel retire the block
+    usleep(5000);
+  }
+
+  // All four blocks are held, nothing more can be received
+  sendPackets(TestPort, {100});
+  for (int i = 0; i < 10; i++) {
+    ASSERT_FALSE(Receiver->receive(Data, Length, 10));
+  }
+  ASSERT_EQ(Receiver->blocksInUse(), 4);
+
+  Receiver->releaseBlocks(2);
+  ASSERT_EQ(Receiver->blocksInUse(), 2);
+  Receiver->releaseBlocks(4);
+  ASSERT_EQ(Receiver->blocksInUse(), 0);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,7 +1,8 @@
-// Copyright (C) 2020 - 2025 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2020 - 2026 European Spallation Source, ERIC. See LICENSE file
 
 #include <common/memory/PoolAllocator.h>
 #include <common/testutils/TestBase.h>
+#include <thread>
 
 class PoolAllocatorTest : public TestBase {
 public:
@@ -111,6 +112,32 @@ TEST_F(PoolAllocatorTest, Share_2) {
   ASSERT_EQ(pool.ValidateEmptyStateAndReturnError(), nullptr);
 }
 
+TEST_F(PoolAllocatorTest, ThreadSafeShared) {
+  using AllocConfig =
+      PoolAllocatorConfig<int, sizeof(int) * 4 * 64, 4, true, true, true>;
+  static AllocConfig::PoolType pool;
+  PoolAllocator<AllocConfig> alloc(pool);
+
+  auto Work = [&alloc]() {
+    for (int i = 0; i < 10000; i++) {
+      std::vector<int, decltype(alloc)> v(alloc);
+      v.reserve(4);
+      v.push_back(i);
+      ASSERT_EQ(v[0], i);
+    }
+  };
+  std::vector<std::thread> Threads;
+  for (int i = 0; i < 4; i++) {
+    Threads.emplace_back(Work);
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  ASSERT_EQ(pool.NumSlotsUsed, 0);
+  ASSERT_EQ(pool.Stats.AllocCount, pool.Stats.DeallocCount);
+  ASSERT_EQ(pool.ValidateEmptyStateAndReturnError(), nullptr);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -85,6 +85,21 @@ TEST_F(RingBufferTest, OverWriteNext) {
   ASSERT_FALSE(buf.verifyBufferCookies(index));
 }
 
+TEST_F(RingBufferTest, ExternalBuffer) {
+  RingBuffer<9000> buf(10);
+  char External[100];
+  unsigned int index = buf.getDataIndex();
+  char *Own = buf.getDataBuffer(index);
+
+  buf.setExternalBuffer(index, External, 100);
+  ASSERT_EQ(buf.getDataBuffer(index), External);
+  ASSERT_EQ(buf.getDataLength(index), 100);
+  ASSERT_TRUE(buf.verifyBufferCookies(index));
+
+  buf.setExternalBuffer(index, nullptr, 0);
+  ASSERT_EQ(buf.getDataBuffer(index), Own);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,79 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief Producer/consumer throughput of the SPSC fifo variants
+///
+/// The producer runs in a separate thread, the benchmark loop is the
+/// consumer. Items are ringbuffer indices as for the detector input fifo.
+
+#include <benchmark/benchmark.h>
+#include <common/memory/SPSCFifo.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+static constexpr size_t FifoSize{2000};
+static constexpr size_t BulkSize{32};
+
+using SeqCstFifo =
+    memory_sequential_consistent::CircularFifo<unsigned int, FifoSize>;
+using AcqRelFifo =
+    memory_relaxed_acquire_release::CircularFifo<unsigned int, FifoSize>;
+
+template <typename Fifo> static void SingleItems(benchmark::State &state) {
+  auto Queue = std::make_unique<Fifo>();
+  std::atomic_bool Run{true};
+  std::thread Producer([&Queue, &Run]() {
+    unsigned int Index{0};
+    while (Run) {
+      if (Queue->push(Index)) {
+        Index++;
+      }
+    }
+  });
+
+  int64_t Items{0};
+  unsigned int Value;
+  for (auto _ : state) {
+    while (not Queue->pop(Value)) {
+    }
+    benchmark::DoNotOptimize(Value);
+    Items++;
+  }
+  Run = false;
+  Producer.join();
+  state.SetItemsProcessed(Items);
+}
+BENCHMARK_TEMPLATE(SingleItems, SeqCstFifo)->UseRealTime();
+BENCHMARK_TEMPLATE(SingleItems, AcqRelFifo)->UseRealTime();
+
+static void BulkItems(benchmark::State &state) {
+  auto Queue = std::make_unique<AcqRelFifo>();
+  std::atomic_bool Run{true};
+  std::thread Producer([&Queue, &Run]() {
+    unsigned int Index{0};
+    unsigned int Values[BulkSize];
+    while (Run) {
+      for (size_t i = 0; i < BulkSize; i++) {
+        Values[i] = Index + i;
+      }
+      Index += Queue->pushBulk(Values, BulkSize);
+    }
+  });
+
+  int64_t Items{0};
+  unsigned int Values[BulkSize];
+  for (auto _ : state) {
+    size_t N;
+    while ((N = Queue->popBulk(Values, BulkSize)) == 0) {
+    }
+    benchmark::DoNotOptimize(Values);
+    Items += N;
+  }
+  Run = false;
+  Producer.join();
+  state.SetItemsProcessed(Items);
+}
+BENCHMARK(BulkItems)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,125 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+#include <common/memory/SPSCFifo.h>
+#include <common/testutils/TestBase.h>
+#include <thread>
+#include <vector>
+
+using Fifo = memory_relaxed_acquire_release::CircularFifo<unsigned int, 10>;
+
+class SPSCFifoTest : public TestBase {
+protected:
+  Fifo Queue;
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+// Test cases below
+TEST_F(SPSCFifoTest, Constructor) {
+  ASSERT_TRUE(Queue.wasEmpty());
+  ASSERT_FALSE(Queue.wasFull());
+  ASSERT_EQ(Queue.size(), 0);
+  ASSERT_EQ(Queue.free(), 10);
+  ASSERT_TRUE(Queue.isLockFree());
+}
+
+TEST_F(SPSCFifoTest, PushPopUntilFull) {
+  unsigned int Value;
+  ASSERT_FALSE(Queue.pop(Value));
+
+  for (unsigned int i = 0; i < 10; i++) {
+    ASSERT_TRUE(Queue.push(i));
+  }
+  ASSERT_TRUE(Queue.wasFull());
+  ASSERT_FALSE(Queue.push(10));
+  ASSERT_EQ(Queue.size(), 10);
+
+  for (unsigned int i = 0; i < 10; i++) {
+    ASSERT_TRUE(Queue.pop(Value));
+    ASSERT_EQ(Value, i);
+  }
+  ASSERT_TRUE(Queue.wasEmpty());
+  ASSERT_FALSE(Queue.pop(Value));
+}
+
+TEST_F(SPSCFifoTest, BulkWrapAround) {
+  unsigned int In[8]{1, 2, 3, 4, 5, 6, 7, 8};
+  unsigned int Out[8]{0};
+
+  // move the indices so the next bulk operations wrap around
+  ASSERT_EQ(Queue.pushBulk(In, 7), 7);
+  ASSERT_EQ(Queue.popBulk(Out, 7), 7);
+  ASSERT_TRUE(Queue.wasEmpty());
+
+  ASSERT_EQ(Queue.pushBulk(In, 8), 8);
+  ASSERT_EQ(Queue.size(), 8);
+  // only two free entries left
+  ASSERT_EQ(Queue.pushBulk(In, 8), 2);
+  ASSERT_TRUE(Queue.wasFull());
+  ASSERT_EQ(Queue.pushBulk(In, 8), 0);
+
+  ASSERT_EQ(Queue.popBulk(Out, 8), 8);
+  for (unsigned int i = 0; i < 8; i++) {
+    ASSERT_EQ(Out[i], In[i]);
+  }
+  ASSERT_EQ(Queue.popBulk(Out, 8), 2);
+  ASSERT_EQ(Out[0], 1);
+  ASSERT_EQ(Out[1], 2);
+  ASSERT_EQ(Queue.popBulk(Out, 8), 0);
+}
+
+TEST_F(SPSCFifoTest, MixedSingleAndBulk) {
+  unsigned int Value;
+  unsigned int Out[4]{0};
+  ASSERT_TRUE(Queue.push(42));
+  ASSERT_EQ(Queue.popBulk(Out, 4), 1);
+  ASSERT_EQ(Out[0], 42);
+
+  unsigned int In[3]{7, 8, 9};
+  ASSERT_EQ(Queue.pushBulk(In, 3), 3);
+  for (unsigned int i = 0; i < 3; i++) {
+    ASSERT_TRUE(Queue.pop(Value));
+    ASSERT_EQ(Value, In[i]);
+  }
+}
+
+TEST_F(SPSCFifoTest, ProducerConsumerThreads) {
+  const unsigned int Count{100000};
+
+  std::thread Producer([this, Count]() {
+    unsigned int Next{0};
+    while (Next < Count) {
+      if (Next % 2) {
+        unsigned int Items[5];
+        unsigned int N = std::min(5U, Count - Next);
+        for (unsigned int i = 0; i < N; i++) {
+          Items[i] = Next + i;
+        }
+        Next += Queue.pushBulk(Items, N);
+      } else if (Queue.push(Next)) {
+        Next++;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  unsigned int Expected{0};
+  unsigned int Items[7];
+  while (Expected < Count) {
+    size_t N = Queue.popBulk(Items, 7);
+    if (N == 0) {
+      std::this_thread::yield();
+    }
+    for (size_t i = 0; i < N; i++) {
+      ASSERT_EQ(Items[i], Expected++);
+    }
+  }
+  Producer.join();
+  ASSERT_TRUE(Queue.wasEmpty());
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+#include <common/system/WaitStrategy.h>
+#include <common/testutils/TestBase.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono;
+
+class WaitStrategyTest : public TestBase {
+protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+// Test cases below
+TEST_F(WaitStrategyTest, ModeFromString) {
+  ASSERT_EQ(WaitStrategy::modeFromString("sleep"), WaitStrategy::Mode::Sleep);
+  ASSERT_EQ(WaitStrategy::modeFromString("spin"), WaitStrategy::Mode::Spin);
+  ASSERT_EQ(WaitStrategy::modeFromString("adaptive"),
+            WaitStrategy::Mode::Adaptive);
+  ASSERT_THROW(WaitStrategy::modeFromString("nap"), std::runtime_error);
+}
+
+TEST_F(WaitStrategyTest, DataAvailableReturnsImmediately) {
+  WaitStrategy Wait(WaitStrategy::Mode::Adaptive, 10'000'000);
+  int Checks{0};
+  auto Start = steady_clock::now();
+  Wait.wait([&Checks]() { return ++Checks > 0; });
+  ASSERT_EQ(Checks, 1);
+  ASSERT_LT(steady_clock::now() - Start, seconds(1));
+}
+
+TEST_F(WaitStrategyTest, AdaptiveTimesOut) {
+  WaitStrategy Wait(WaitStrategy::Mode::Adaptive, 20'000);
+  auto Start = steady_clock::now();
+  Wait.wait([]() { return false; });
+  ASSERT_GE(steady_clock::now() - Start, microseconds(20'000));
+}
+
+TEST_F(WaitStrategyTest, NotifyWakesBlockedConsumer) {
+  WaitStrategy Wait(WaitStrategy::Mode::Adaptive, 10'000'000);
+  std::atomic_bool Data{false};
+
+  std::thread Producer([&Wait, &Data]() {
+    std::this_thread::sleep_for(milliseconds(50));
+    Data = true;
+    Wait.notify();
+  });
+
+  auto Start = steady_clock::now();
+  Wait.wait([&Data]() { return Data.load(); });
+  Producer.join();
+  ASSERT_TRUE(Data);
+  // well before the 10s timeout
+  ASSERT_LT(steady_clock::now() - Start, seconds(5));
+}
+
+TEST_F(WaitStrategyTest, NotifyWithoutWaiter) {
+  WaitStrategy Wait(WaitStrategy::Mode::Adaptive, 1000);
+  Wait.notify();
+  WaitStrategy Sleep(WaitStrategy::Mode::Sleep);
+  Sleep.notify();
+  ASSERT_EQ(Sleep.getMode(), WaitStrategy::Mode::Sleep);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -123,4 +123,61 @@ tof_t ESSReferenceTime::getPrevTOF(const ESSTime &eventTime, uint32_t DelayNS) {
   return (timeval - PrevTimeInNS).count();
 }
 
+size_t ESSReferenceTime::getTOFs(const uint32_t *TimeHigh,
+                                 const uint32_t *TimeLow, size_t Count,
+                                 uint64_t *TOF, uint8_t *Valid,
+                                 uint32_t DelayNS) {
+  // Event times in ns, using the TOF array as scratch space
+  uint32_t OutOfRange{0};
+  for (size_t i = 0; i < Count; i++) {
+    TOF[i] = TimeHigh[i] * uint64_t(ESSTime::SecInNs.count()) +
+             ESSTime::ticksToNS(TimeLow[i]) + DelayNS;
+    OutOfRange |= TimeLow[i] > ESSTime::MaxFixedPointTicks;
+  }
+
+  // Low parts larger than a second are invalid, but handle them as toNS()
+  if (OutOfRange) {
+    for (size_t i = 0; i < Count; i++) {
+      if (TimeLow[i] > ESSTime::MaxFixedPointTicks) {
+        TOF[i] = ESSTime::toNS(TimeHigh[i], TimeLow[i]).count() + DelayNS;
+      }
+    }
+  }
+
+  // Same decisions as getTOF() and getPrevTOF(), but without branches
+  const int64_t Ref = TimeInNS.count();
+  const int64_t PrevRef = PrevTimeInNS.count();
+  const int64_t Max = MaxTOF.count();
+  int64_t Negative{0};
+  int64_t High{0};
+  int64_t PrevNegative{0};
+  int64_t PrevHigh{0};
+  int64_t Good{0};
+  for (size_t i = 0; i < Count; i++) {
+    int64_t Tof = static_cast<int64_t>(TOF[i]) - Ref;
+    int64_t PrevTof = static_cast<int64_t>(TOF[i]) - PrevRef;
+    bool IsNegative = Tof < 0;
+    bool IsHigh = not IsNegative && Tof > Max;
+    bool IsPrevNegative = IsNegative && PrevTof < 0;
+    bool IsPrevHigh = IsNegative && not IsPrevNegative && PrevTof > Max;
+    bool IsValid = not(IsHigh || IsPrevNegative || IsPrevHigh);
+
+    TOF[i] = IsValid ? (IsNegative ? PrevTof : Tof) : 0;
+    Valid[i] = IsValid;
+    Negative += IsNegative;
+    High += IsHigh;
+    PrevNegative += IsPrevNegative;
+    PrevHigh += IsPrevHigh;
+    Good += IsValid;
+  }
+
+  Counters.TofNegative += Negative;
+  Counters.TofHigh += High;
+  Counters.PrevTofNegative += PrevNegative;
+  Counters.PrevTofHigh += PrevHigh;
+  Counters.PrevTofCount += Negative - PrevNegative - PrevHigh;
+  Counters.TofCount += Good - (Negative - PrevNegative - PrevHigh);
+  return Good;
+}
+
 } // namespace esstime
@@ -180,6 +180,10 @@ public:
       std::chrono::duration_cast<TimeDurationNano>(std::chrono::seconds(1));
   static constexpr double ESSClockFreqHz{88052500};
   static constexpr double ESSClockTick{SecInNs.count() / ESSClockFreqHz};
+  /// ESSClockTick as Q28 fixed point, rounded up, for ticksToNS()
+  static constexpr uint64_t ESSClockTickQ28{3048584152};
+  /// Largest tick count for which ticksToNS() is exact
+  static constexpr uint32_t MaxFixedPointTicks{(1U << 27) - 1};
 
   ///
   /// \brief Default constructor.
@@ -343,6 +347,21 @@ public:
                             (uint64_t)(Low * ESSClockTick));
   }
 
+  ///
+  /// \brief Converts clock ticks to nanoseconds using integer arithmetic only,
+  /// so that loops over it can be vectorized. Rounds down like toNS().
+  ///
+  /// \param Low The low part of the timestamp, at most MaxFixedPointTicks.
+  /// \return The number of nanoseconds.
+  ///
+  inline static uint64_t ticksToNS(uint32_t Low) {
+    uint64_t NS = (Low * ESSClockTickQ28) >> 28;
+    // ESSClockTickQ28 is rounded up, so NS is at most one too large
+    NS -= (Low * uint64_t(SecInNs.count())) <
+          (NS * uint64_t(ESSClockFreqHz));
+    return NS;
+  }
+
   ///
   /// \brief Returns the high part of the timestamp.
   /// \return The high part of the timestamp.
@@ -501,6 +520,23 @@ public:
   ///
   tof_t getPrevTOF(const ESSTime &EventTime, uint32_t DelayNS = 0);
 
+  ///
+  /// \brief Calculates the TOF values of a batch of event times in one pass.
+  /// Results and counters are the same as when calling getTOF() for each
+  /// event time, but counters are updated once per batch.
+  ///
+  /// \param TimeHigh The high parts of the event times.
+  /// \param TimeLow The low parts of the event times.
+  /// \param Count The number of event times.
+  /// \param TOF Output, the TOF values, 0 where not valid.
+  /// \param Valid Output, 1 where the TOF value is valid, 0 otherwise.
+  /// \param DelayNS The delay in nanoseconds.
+  /// \return The number of valid TOF values.
+  ///
+  size_t getTOFs(const uint32_t *TimeHigh, const uint32_t *TimeLow,
+                 size_t Count, uint64_t *TOF, uint8_t *Valid,
+                 uint32_t DelayNS = 0);
+
   ///
   /// \brief Equality comparison operator.
   ///
@@ -7,8 +7,54 @@
 ///
 //===----------------------------------------------------------------------===//
 
+#include <common/JsonFile.h>
+#include <common/system/Numa.h>
 #include <efu/MainProg.h>
 #include <efu/Launcher.h>
+#include <future>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+Launcher::AffinityMap Launcher::getAffinity(const BaseSettings &Settings) {
+  AffinityMap Affinity;
+
+  if (not Settings.ConfigFile.empty()) {
+    nlohmann::json Root;
+    try {
+      Root = Json::fromFile(Settings.ConfigFile);
+    } catch (const std::exception &) {
+      // missing or invalid config files are reported by the detector
+    }
+    if (Root.is_object() and Root.contains("ThreadAffinity")) {
+      try {
+        for (auto &[Name, Core] : Root["ThreadAffinity"].items()) {
+          Affinity[Name] = Core.get<int>();
+        }
+      } catch (const nlohmann::json::exception &e) {
+        throw std::runtime_error(fmt::format(
+            "Invalid ThreadAffinity in {}: {}", Settings.ConfigFile, e.what()));
+      }
+    }
+  }
+
+  for (auto &Entry : Settings.ThreadAffinity) {
+    auto Colon = Entry.rfind(':');
+    if (Colon == std::string::npos or Colon == 0) {
+      throw std::runtime_error(
+          fmt::format("Invalid affinity '{}', expected thread:core", Entry));
+    }
+    try {
+      Affinity[Entry.substr(0, Colon)] = std::stoi(Entry.substr(Colon + 1));
+    } catch (const std::exception &) {
+      throw std::runtime_error(
+          fmt::format("Invalid affinity '{}', expected thread:core", Entry));
+    }
+  }
+  return Affinity;
+}
 
 void Launcher::launchThreads(std::shared_ptr<Detector> &detector) {
   auto startThreadsWithoutAffinity = [&detector, this]() {
@@ -22,9 +68,117 @@ void Launcher::launchThreads(std::shared_ptr<Detector> &detector) {
     }
   };
 
-  startThreadsWithoutAffinity();
+  auto startThreadsWithAffinity = [&detector, this]() {
+    LOG(INIT, Sev::Info, "Launching threads with core affinity.");
+    for (auto &ThreadInfo : detector->GetThreadInfo()) {
+      auto It = CoreAffinity.find(ThreadInfo.name);
+      if (It == CoreAffinity.end()) {
+        LOG(INIT, Sev::Info, "Thread {} not pinned", ThreadInfo.name);
+        ThreadInfo.thread = std::thread([this, &ThreadInfo]() { exceptionHandlingWrapper(ThreadInfo); });
+        continue;
+      }
+
+      int Core = It->second;
+      int Node = Numa::nodeOfCpu(Core);
+
+      // Input buffers should be local to the input thread. Thread names are
+      // "input" for the first input queue and "input_N" for the others
+      size_t QueueIndex{0};
+      bool IsInput = ThreadInfo.name == "input";
+      if (ThreadInfo.name.rfind("input_", 0) == 0) {
+        try {
+          QueueIndex = std::stoul(ThreadInfo.name.substr(6));
+          IsInput = true;
+        } catch (const std::exception &) {
+        }
+      }
+      if (IsInput and Node >= 0) {
+        if (detector->placeInputQueue(QueueIndex, Node)) {
+          LOG(INIT, Sev::Info, "Input buffers for {} placed on NUMA node {}",
+              ThreadInfo.name, Node);
+        } else {
+          LOG(INIT, Sev::Warning,
+              "Unable to place input buffers for {} on NUMA node {}",
+              ThreadInfo.name, Node);
+        }
+      }
+
+      // The thread waits until it is pinned, so its allocations are local
+      // and the affinity is in place when launchThreads() returns
+      std::promise<void> Pinned;
+      ThreadInfo.thread = std::thread(
+          [this, &ThreadInfo, PinnedFuture = Pinned.get_future()]() {
+            PinnedFuture.wait();
+            exceptionHandlingWrapper(ThreadInfo);
+          });
+      if (pinToCore(ThreadInfo.thread, Core)) {
+        LOG(INIT, Sev::Info, "Thread {} pinned to core {} (NUMA node {})",
+            ThreadInfo.name, Core, Node);
+      } else {
+        LOG(INIT, Sev::Error, "Failed to pin thread {} to core {}",
+            ThreadInfo.name, Core);
+      }
+      Pinned.set_value();
+    }
+  };
+
+  if (CoreAffinity.empty()) {
+    startThreadsWithoutAffinity();
+  } else {
+    startThreadsWithAffinity();
+  }
+}
+
+#ifdef __linux__
+
+bool Launcher::pinToCore(std::thread &Thread, int Core) {
+  if (Core < 0 or Core >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t CpuSet;
+  CPU_ZERO(&CpuSet);
+  CPU_SET(Core, &CpuSet);
+  return pthread_setaffinity_np(Thread.native_handle(), sizeof(CpuSet),
+                                &CpuSet) == 0;
 }
 
+int64_t Launcher::checkAffinity(std::shared_ptr<Detector> &detector) {
+  int64_t Misplaced{0};
+  for (auto &ThreadInfo : detector->GetThreadInfo()) {
+    auto It = CoreAffinity.find(ThreadInfo.name);
+    if (It == CoreAffinity.end() or not ThreadInfo.thread.joinable()) {
+      continue;
+    }
+    cpu_set_t CpuSet;
+    CPU_ZERO(&CpuSet);
+    if (pthread_getaffinity_np(ThreadInfo.thread.native_handle(),
+                               sizeof(CpuSet), &CpuSet) != 0 or
+        CPU_COUNT(&CpuSet) != 1 or not CPU_ISSET(It->second, &CpuSet)) {
+      Misplaced++;
+    }
+  }
+  ThreadsMisplaced = Misplaced;
+  return Misplaced;
+}
+
+#else
+
+bool Launcher::pinToCore(std::thread &, int) { return false; }
+
+// Pinning is not supported, so every pinned thread is misplaced
+int64_t Launcher::checkAffinity(std::shared_ptr<Detector> &detector) {
+  int64_t Misplaced{0};
+  for (auto &ThreadInfo : detector->GetThreadInfo()) {
+    if (CoreAffinity.count(ThreadInfo.name)) {
+      Misplaced++;
+    }
+  }
+  ThreadsMisplaced = Misplaced;
+  return Misplaced;
+}
+
+#endif
+
 void Launcher::exceptionHandlingWrapper(ThreadInfo &ThreadInfo) {
   try {
     ThreadInfo.func();
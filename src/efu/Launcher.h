@@ -16,6 +16,8 @@
 #include <common/detector/Detector.h>
 #include <common/detector/EFUArgs.h>
 #include <functional>
+#include <map>
+#include <string>
 #include <vector>
 
 ///
@@ -30,12 +32,24 @@
 class Launcher {
 public:
 
+  using AffinityMap = std::map<std::string, int>; ///< thread name to core
+
   ///
   /// \brief Constructor for the Launcher class
   /// \param keep_running Reference to an integer that controls the running
   /// state
+  /// \param Affinity cores to pin threads to, by thread name
+  ///
+  Launcher(int &keep_running, AffinityMap Affinity = {})
+      : KeepRunningRef(keep_running), CoreAffinity(std::move(Affinity)) {}
+
   ///
-  Launcher(int &keep_running) : KeepRunningRef(keep_running) {}
+  /// \brief Build the thread affinity map from settings. Entries in the
+  /// "ThreadAffinity" object of the detector configuration file (if any)
+  /// are overridden by --affinity thread:core command line entries
+  /// \throws std::runtime_error on malformed entries
+  ///
+  static AffinityMap getAffinity(const BaseSettings &Settings);
 
   ///
   /// \brief Launches the threads for the detector
@@ -43,9 +57,27 @@ public:
   ///
   void launchThreads(std::shared_ptr<Detector> &detector);
 
+  ///
+  /// \brief Check that pinned threads are still restricted to their
+  /// requested core, updates ThreadsMisplaced
+  /// \return number of misplaced threads
+  ///
+  int64_t checkAffinity(std::shared_ptr<Detector> &detector);
+
+  /// Number of pinned threads not on their requested core (stat)
+  int64_t ThreadsMisplaced{0};
+
 private:
   int &KeepRunningRef; ///< Reference to a flag of main loop to keep running
 
+  AffinityMap CoreAffinity;
+
+  ///
+  /// \brief Pin a thread to a core
+  /// \return true on success
+  ///
+  static bool pinToCore(std::thread &Thread, int Core);
+
   ///
   /// \brief Wrapper function for handling exceptions in threads
   ///        and initiating graceful shutdown in case of unhandled exceptions
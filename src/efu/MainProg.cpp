@@ -90,7 +90,16 @@ int MainProg::run(Detector *inst) {
   LOG(MAIN, Sev::Info, "Launching EFU as Instrument {}",
       DetectorSettings.DetectorName);
 
-  Launcher launcher(keep_running);
+  Launcher::AffinityMap Affinity;
+  try {
+    Affinity = Launcher::getAffinity(DetectorSettings);
+  } catch (const std::runtime_error &e) {
+    LOG(MAIN, Sev::Error, "({}) {}", Name, e.what());
+    return -1;
+  }
+
+  Launcher launcher(keep_running, Affinity);
+  mainStats.create("main.threads_misplaced", launcher.ThreadsMisplaced);
 
   launcher.launchThreads(detector);
 
@@ -123,6 +132,7 @@ int MainProg::run(Detector *inst) {
 
     if (LiveStats.timeUS() >= MicrosecondsPerSecond) {
       statUpTime = RunTimer.timeUS() / 1000000;
+      launcher.checkAffinity(detector);
       metrics.publish(detector, mainStats);
       LiveStats.reset();
     }
@@ -87,6 +87,42 @@ TEST_F(LauncherTest, MutipleThreadsOneThrowsExceptionHandled) {
   EXPECT_EQ(keep_running, 0);
 }
 
+TEST_F(LauncherTest, GetAffinityFromSettings) {
+  BaseSettings Settings;
+  ASSERT_TRUE(Launcher::getAffinity(Settings).empty());
+
+  Settings.ThreadAffinity = {"input:2", "processing:4", "input:3"};
+  auto Affinity = Launcher::getAffinity(Settings);
+  ASSERT_EQ(Affinity.size(), 2);
+  ASSERT_EQ(Affinity["input"], 3); // last entry wins
+  ASSERT_EQ(Affinity["processing"], 4);
+}
+
+TEST_F(LauncherTest, GetAffinityInvalid) {
+  BaseSettings Settings;
+  Settings.ThreadAffinity = {"input"};
+  ASSERT_THROW(Launcher::getAffinity(Settings), std::runtime_error);
+  Settings.ThreadAffinity = {"input:core"};
+  ASSERT_THROW(Launcher::getAffinity(Settings), std::runtime_error);
+  Settings.ThreadAffinity = {":2"};
+  ASSERT_THROW(Launcher::getAffinity(Settings), std::runtime_error);
+}
+
+#ifdef __linux__
+TEST_F(LauncherTest, PinnedThreadsOnRequestedCore) {
+  Launcher PinningLauncher(keep_running, {{"TestThread0", 0}});
+  PinningLauncher.launchThreads(detector);
+
+  ASSERT_EQ(PinningLauncher.checkAffinity(detector), 0);
+  ASSERT_EQ(PinningLauncher.ThreadsMisplaced, 0);
+
+  for (auto &ThreadInfo : detector->GetThreadInfo()) {
+    ThreadInfo.thread.join();
+  }
+  EXPECT_EQ(ThreadFinishedCounter, number_of_threads);
+}
+#endif
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -25,7 +25,7 @@
 // #define TRC_LEVEL TRC_L_DEB
 
 namespace caen {
-class BifrostGeometry : public Geometry, ESSGeometry {
+class BifrostGeometry final : public Geometry, ESSGeometry {
 public:
   explicit BifrostGeometry(Statistics &Stats, Config &CaenConfiguration);
 
@@ -62,6 +62,9 @@ public:
   Config &Conf;
 
 protected:
+  /// calcPixelStatic() calls calcPixelImpl() directly
+  friend class DetectorGeometry<DataParser::CaenReadout>;
+
   /// \brief Implementation for pixel calculation for Bifrost geometry
   /// \param Data Const reference to CaenReadout object
   /// \return Calculated pixel ID, or 0 if calculation failed
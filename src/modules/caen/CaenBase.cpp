@@ -14,8 +14,10 @@
 #include <memory>
 #include <modules/caen/CaenBase.h>
 #include <modules/caen/CaenInstrument.h>
+#include <modules/caen/CaenWorker.h>
 
 #include <cinttypes>
+#include <thread>
 #include <unistd.h>
 
 // #undef TRC_LEVEL
@@ -55,20 +57,46 @@ CaenBase::CaenBase(BaseSettings const &settings, DetectorType type)
 
   // Produce cause call stats
   Stats.create("produce.cause.timeout", Counters.ProduceCauseTimeout);
+  Stats.create("produce.zero_copy", Counters.ProduceZeroCopy);
+  Stats.create("produce.copied", Counters.ProduceCopied);
 
   // clang-format on
-  std::function<void()> inputFunc = [this]() { inputThread(); };
-  AddThreadFunction(inputFunc, "input");
+  addInputThreads();
 
   std::function<void()> processingFunc = [this]() {
     CaenBase::processingThread();
   };
   Detector::AddThreadFunction(processingFunc, "processing");
 
+  if (EFUSettings.ProcessingWorkers > 1) {
+    for (size_t i = 0; i < EFUSettings.ProcessingWorkers; i++) {
+      Workers.emplace_back(std::make_unique<CaenWorker>(EFUSettings));
+      std::function<void()> workerFunc = [this, i]() {
+        CaenBase::workerThread(i);
+      };
+      Detector::AddThreadFunction(workerFunc, fmt::format("worker_{}", i));
+    }
+
+    // Geometry stats live in the workers, register their sums instead
+    auto &First = *Workers[0];
+    WorkerStatTotals.resize(First.Stats.size() + 1 - First.FirstInstrumentStat);
+    for (size_t i = 0; i < WorkerStatTotals.size(); i++) {
+      Stats.create(First.Stats.getStatName(First.FirstInstrumentStat + i),
+                   WorkerStatTotals[i]);
+    }
+
+    // Header validation is still done here, with the configured limits
+    ESSHeaderParser.MaxPulseTimeDiffNS = First.ESSHeaderParser.MaxPulseTimeDiffNS;
+    LOG(INIT, Sev::Info, "Caen processing with {} worker threads",
+        Workers.size());
+  }
+
   XTRACE(INIT, ALW, "Creating %d Caen Rx ringbuffers of size %d",
          EthernetBufferMaxEntries, EthernetBufferSize);
 }
 
+CaenBase::~CaenBase() = default;
+
 /// \brief Normal processing thread
 void CaenBase::processingThread() {
   if (EFUSettings.KafkaTopic.empty()) {
@@ -78,21 +106,29 @@ void CaenBase::processingThread() {
 
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
 
-  auto Produce = [&EventProducer](auto DataBuffer, auto Timestamp) {
-    EventProducer.produce(DataBuffer, Timestamp);
-  };
-
-  // Create the instrument
-  CaenInstrument Caen(Stats, Counters, EFUSettings, ESSHeaderParser);
+  // Create the instrument, workers have their own
+  std::unique_ptr<CaenInstrument> Caen;
+  if (Workers.empty()) {
+    Caen = std::make_unique<CaenInstrument>(Stats, Counters, EFUSettings,
+                                            ESSHeaderParser);
+    // Readouts are processed before the ring buffer entry is reused
+    Caen->CaenParser.setInPlace(true);
+  }
+  Geometry *Geom = Caen ? Caen->Geom : Workers[0]->Caen.Geom;
   // and its serializers
-  Serializers.reserve(Caen.Geom->numSerializers());
-  for (size_t i = 0; i < Caen.Geom->numSerializers(); ++i) {
+  Serializers.reserve(Geom->numSerializers());
+  for (size_t i = 0; i < Geom->numSerializers(); ++i) {
     Serializers.emplace_back(std::make_shared<EV44Serializer>(
-        KafkaBufferSize, Caen.Geom->serializerName(i), Produce));
+        KafkaBufferSize, Geom->serializerName(i), EventProducer));
   }
   // give the instrument shared pointers to the serializers
-  Caen.setSerializers(Serializers);
+  if (Caen) {
+    Caen->setSerializers(Serializers);
+  }
 
   RuntimeStat RtStat({getInputCounters().RxPackets, Counters.Events,
                       EventProducer.getStats().MsgStatusPersisted});
@@ -105,8 +141,8 @@ void CaenBase::processingThread() {
 
     auto idle_start = local_clock::now();
 
-    if (InputFifo.pop(DataIndex)) { // There is data in the FIFO - do processing
-      auto DataLen = RxRingbuffer.getDataLength(DataIndex);
+    if (auto RxRing = popInput(DataIndex)) { // There is data - do processing
+      auto DataLen = RxRing->getDataLength(DataIndex);
       if (DataLen == 0) {
         XTRACE(DATA, ERR, "Data length in FIFO is zero");
         ITCounters.FifoSeqErrors++;
@@ -118,7 +154,7 @@ void CaenBase::processingThread() {
 
       /// \todo use the Buffer<T> class here and in parser?
       /// \todo avoid copying by passing reference to stats like for gdgem?
-      auto DataPtr = RxRingbuffer.getDataBuffer(DataIndex);
+      auto DataPtr = RxRing->getDataBuffer(DataIndex);
       auto Res = ESSHeaderParser.validate(DataPtr, DataLen, Type);
 
       if (Res != ess_readout::Parser::OK) {
@@ -127,19 +163,31 @@ void CaenBase::processingThread() {
         continue;
       }
 
-      // We have good header information, now parse readout data
-      Res = Caen.CaenParser.parse(ESSHeaderParser.Packet.DataPtr,
-                                  ESSHeaderParser.Packet.DataLength);
+      if (not Workers.empty()) {
+        dispatchToWorker();
+        mergeWorkerEvents();
+      } else {
+        // We have good header information, now parse readout data
+        Res = Caen->CaenParser.parse(ESSHeaderParser.Packet.DataPtr,
+                                     ESSHeaderParser.Packet.DataLength);
 
-      // Process readouts, generate (and produce) events
-      Caen.processReadouts();
+        // Process readouts, generate (and produce) events
+        Caen->processReadouts();
 
-      /// \todo This could be moved and done less frequently
-      Counters.Parser = Caen.CaenParser.Stats;
-      Counters.Calibration = Caen.Geom->CaenCDCalibration.Stats;
+        /// \todo This could be moved and done less frequently
+        Counters.Parser = Caen->CaenParser.Stats;
+        Counters.Calibration = Caen->Geom->CaenCDCalibration.Stats;
+      }
+
+    } else if (not workersIdle()) { // No new data, but workers are busy
+      mergeWorkerEvents();
+      std::this_thread::yield();
 
-    } else { // There is NO data in the FIFO - do stop checks and sleep a little
-      usleep(100); // sleep 100 microsecond
+    } else { // There is NO data in the FIFO - do stop checks and wait for data
+      if (not Workers.empty()) {
+        updateWorkerCounters();
+      }
+      waitForInput();
       Counters.ProcessingIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
@@ -151,6 +199,10 @@ void CaenBase::processingThread() {
 
     if (ProduceTimer.timeout()) {
       // XTRACE(DATA, DEB, "Serializer timer timed out, producing message now");
+      if (not Workers.empty()) {
+        mergeWorkerEvents();
+        updateWorkerCounters();
+      }
       RuntimeStatusMask = RtStat.getRuntimeStatusMask(
           {getInputCounters().RxPackets, Counters.Events,
            EventProducer.getStats().MsgStatusPersisted});
@@ -169,9 +221,124 @@ void CaenBase::processingThread() {
           [](auto &Serializer) {
             return Serializer->ProduceCauseMaxEventsReached;
           });
+      Counters.ProduceZeroCopy = std::transform_reduce(
+          Serializers.begin(), Serializers.end(), 0, std::plus<>(),
+          [](auto &Serializer) { return Serializer->stats().ProduceZeroCopy; });
+      Counters.ProduceCopied = std::transform_reduce(
+          Serializers.begin(), Serializers.end(), 0, std::plus<>(),
+          [](auto &Serializer) { return Serializer->stats().ProduceCopied; });
     }
   }
 
   XTRACE(INPUT, ALW, "Stopping processing thread.");
 }
+
+void CaenBase::workerThread(size_t Index) {
+  auto &Worker = *Workers[Index];
+  while (runThreads) {
+    if (not Worker.processNext()) {
+      Worker.waitForWork();
+    }
+  }
+  XTRACE(INPUT, ALW, "Stopping worker thread %zu.", Index);
+}
+
+void CaenBase::dispatchToWorker() {
+  // All packets from an OutputQueue go to the same worker
+  size_t Index =
+      ESSHeaderParser.Packet.HeaderPtr.getOutputQueue() % Workers.size();
+  auto &Worker = *Workers[Index];
+
+  while (Worker.full()) {
+    if (not runThreads) {
+      return;
+    }
+    mergeWorkerEvents();
+    if (Worker.full()) {
+      std::this_thread::yield();
+    }
+  }
+
+  Worker.submit(ESSHeaderParser.Packet);
+  WorkerOrder.push_back(Index);
+}
+
+void CaenBase::mergeWorkerEvents() {
+  // Jobs complete in order per worker, so waiting for the oldest job keeps
+  // the order of reference times seen by the serializers
+  while (not WorkerOrder.empty()) {
+    auto Job = Workers[WorkerOrder.front()]->popCompleted();
+    if (Job == nullptr) {
+      return;
+    }
+    WorkerOrder.pop_front();
+
+    auto PacketRefTime = static_cast<int64_t>(Job->PulseTime.toNS().count());
+    for (auto &Serializer : Serializers) {
+      Serializer->checkAndSetReferenceTime(PacketRefTime);
+    }
+
+    for (auto &Event : Job->Events) {
+      if (Event.SerializerId >= Serializers.size()) {
+        XTRACE(EVENT, WAR, "Serializer identification error");
+        Counters.SerializerErrors++;
+        continue;
+      }
+      Serializers[Event.SerializerId]->addEvent(Event.TimeOfFlight,
+                                                Event.PixelId);
+      Counters.Events++;
+    }
+  }
+}
+
+void CaenBase::updateWorkerCounters() {
+  struct DataParser::Stats Parser;
+  struct CDCalibration::Stats Calibration;
+  auto &Time = ESSHeaderParser.Packet.Time.Counters;
+  int64_t TofCount{0}, TofNegative{0}, TofHigh{0};
+  int64_t PrevTofCount{0}, PrevTofNegative{0}, PrevTofHigh{0};
+
+  for (auto &Worker : Workers) {
+    auto &WorkerParser = Worker->Caen.CaenParser.Stats;
+    Parser.DataHeaders += WorkerParser.DataHeaders;
+    Parser.Readouts += WorkerParser.Readouts;
+    Parser.ReadoutsMaxADC += WorkerParser.ReadoutsMaxADC;
+    Parser.RingFenErrors += WorkerParser.RingFenErrors;
+    Parser.DataLenMismatch += WorkerParser.DataLenMismatch;
+    Parser.DataLenInvalid += WorkerParser.DataLenInvalid;
+    Parser.DataHeaderSizeErrors += WorkerParser.DataHeaderSizeErrors;
+
+    auto &WorkerCalibration = Worker->Caen.Geom->CaenCDCalibration.Stats;
+    Calibration.ClampLow += WorkerCalibration.ClampLow;
+    Calibration.ClampHigh += WorkerCalibration.ClampHigh;
+    Calibration.GroupErrors += WorkerCalibration.GroupErrors;
+    Calibration.OutsideInterval += WorkerCalibration.OutsideInterval;
+
+    auto &WorkerTime = Worker->ESSHeaderParser.Packet.Time.Counters;
+    TofCount += WorkerTime.TofCount;
+    TofNegative += WorkerTime.TofNegative;
+    TofHigh += WorkerTime.TofHigh;
+    PrevTofCount += WorkerTime.PrevTofCount;
+    PrevTofNegative += WorkerTime.PrevTofNegative;
+    PrevTofHigh += WorkerTime.PrevTofHigh;
+  }
+
+  Counters.Parser = Parser;
+  Counters.Calibration = Calibration;
+  Time.TofCount = TofCount;
+  Time.TofNegative = TofNegative;
+  Time.TofHigh = TofHigh;
+  Time.PrevTofCount = PrevTofCount;
+  Time.PrevTofNegative = PrevTofNegative;
+  Time.PrevTofHigh = PrevTofHigh;
+
+  for (size_t i = 0; i < WorkerStatTotals.size(); i++) {
+    int64_t Sum{0};
+    for (auto &Worker : Workers) {
+      Sum += Worker->Stats.getValue(Worker->FirstInstrumentStat + i);
+    }
+    WorkerStatTotals[i] = Sum;
+  }
+}
+
 } // namespace caen
@@ -11,9 +11,13 @@
 #include <caen/CaenCounters.h>
 #include <common/detector/Detector.h>
 #include <common/types/DetectorType.h>
+#include <deque>
+#include <memory>
 
 namespace caen {
 
+class CaenWorker;
+
 class CaenBase : public Detector {
 
 private:
@@ -21,14 +25,39 @@ private:
 
 public:
   CaenBase(BaseSettings const &Settings, DetectorType type);
-  ~CaenBase() = default;
+  ~CaenBase();
 
   void processingThread();
 
+  /// \brief parses packets and calculates events when using worker threads
+  void workerThread(size_t Index);
+
   struct CaenCounters Counters;
 
 protected:
   std::vector<std::shared_ptr<EV44Serializer>> Serializers;
+
+  /// Empty unless ProcessingWorkers > 1
+  std::vector<std::unique_ptr<CaenWorker>> Workers;
+
+private:
+  /// \brief queue the current packet on the worker for its OutputQueue
+  void dispatchToWorker();
+
+  /// \brief serialize events of completed jobs, in dispatch order
+  void mergeWorkerEvents();
+
+  /// \brief all jobs have been merged
+  bool workersIdle() const { return WorkerOrder.empty(); }
+
+  /// \brief sum worker stats into Counters and the detector stats
+  void updateWorkerCounters();
+
+  /// Worker index of each job in flight, oldest first
+  std::deque<size_t> WorkerOrder;
+
+  /// Sums of the instrument stats of all workers
+  std::vector<int64_t> WorkerStatTotals;
 };
 
 } // namespace caen
@@ -43,5 +43,9 @@ struct CaenCounters {
   int64_t ProduceCausePulseChange{0};
   int64_t ProduceCauseMaxEventsReached{0};
 
+  // Messages sent from the serializer buffers or copied
+  int64_t ProduceZeroCopy{0};
+  int64_t ProduceCopied{0};
+
 } __attribute__((aligned(64)));
 } // namespace caen
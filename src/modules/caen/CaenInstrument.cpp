@@ -11,6 +11,7 @@
 #include <common/debug/Log.h>
 #include <common/debug/Trace.h>
 #include <common/time/TimeString.h>
+#include <type_traits>
 
 // #undef TRC_LEVEL
 // #define TRC_LEVEL TRC_L_DEB
@@ -27,29 +28,11 @@ using namespace ess_readout;
 CaenInstrument::CaenInstrument(Statistics &Stats, struct CaenCounters &counters,
                                BaseSettings &settings,
                                ess_readout::Parser &essHeaderParser)
-    : counters(counters), Settings(settings), ESSHeaderParser(essHeaderParser) {
-
-  XTRACE(INIT, ALW, "Loading configuration file %s",
-         Settings.ConfigFile.c_str());
-  CaenConfiguration = Config(Settings.ConfigFile);
-  CaenConfiguration.parseConfig();
-
-  if (settings.DetectorName == "loki") {
-    Geom = new LokiGeometry(Stats, CaenConfiguration);
-  } else if (settings.DetectorName == "bifrost") {
-    Geom = new BifrostGeometry(Stats, CaenConfiguration);
-  } else if (settings.DetectorName == "miracles") {
-    Geom = new MiraclesGeometry(Stats, CaenConfiguration);
-  } else if (settings.DetectorName == "cspec") {
-    Geom = new CspecGeometry(Stats, CaenConfiguration);
-  } else if (settings.DetectorName == "tbl3he") {
-    Geom = new Tbl3HeGeometry(Stats, CaenConfiguration);
-  } else {
-    XTRACE(INIT, ERR, "Invalid Detector Name %s",
-           settings.DetectorName.c_str());
-    throw std::runtime_error(
-        fmt::format("Invalid Detector Name {}", settings.DetectorName));
-  }
+    : counters(counters), Settings(settings), ESSHeaderParser(essHeaderParser),
+      CaenConfiguration(loadConfig(settings.ConfigFile)),
+      ConcreteGeom(
+          createGeometry(Stats, settings.DetectorName, CaenConfiguration)),
+      Geom(std::visit([](auto *G) -> Geometry * { return G; }, ConcreteGeom)) {
 
   if (Settings.CalibFile.empty()) {
     throw std::runtime_error("Calibration file is required, none supplied");
@@ -67,29 +50,75 @@ CaenInstrument::CaenInstrument(Statistics &Stats, struct CaenCounters &counters,
 
 CaenInstrument::~CaenInstrument() {}
 
-void CaenInstrument::processReadouts() {
-  XTRACE(DATA, DEB, "Reference time is %" PRIi64,
-         ESSHeaderParser.Packet.Time.getRefTimeUInt64());
-  /// \todo sometimes PrevPulseTime maybe?
-  auto packet_ref_time =
-      static_cast<int64_t>(ESSHeaderParser.Packet.Time.getRefTimeUInt64());
-  for (auto &Serializer : Serializers)
-    Serializer->checkAndSetReferenceTime(packet_ref_time);
+Config CaenInstrument::loadConfig(const std::string &ConfigFile) {
+  XTRACE(INIT, ALW, "Loading configuration file %s", ConfigFile.c_str());
+  Config CaenConfiguration(ConfigFile);
+  CaenConfiguration.parseConfig();
+  return CaenConfiguration;
+}
+
+CaenInstrument::GeometryVariant
+CaenInstrument::createGeometry(Statistics &Stats,
+                               const std::string &DetectorName,
+                               Config &CaenConfiguration) {
+  if (DetectorName == "loki") {
+    return new LokiGeometry(Stats, CaenConfiguration);
+  } else if (DetectorName == "bifrost") {
+    return static_cast<Geometry *>(
+        new BifrostGeometry(Stats, CaenConfiguration));
+  } else if (DetectorName == "miracles") {
+    return new MiraclesGeometry(Stats, CaenConfiguration);
+  } else if (DetectorName == "cspec") {
+    return new CspecGeometry(Stats, CaenConfiguration);
+  } else if (DetectorName == "tbl3he") {
+    return new Tbl3HeGeometry(Stats, CaenConfiguration);
+  }
+  XTRACE(INIT, ERR, "Invalid Detector Name %s", DetectorName.c_str());
+  throw std::runtime_error(fmt::format("Invalid Detector Name {}", DetectorName));
+}
+
+template <typename Function>
+void CaenInstrument::dispatchEvents(Function &&EventFn) {
+  std::visit(
+      [this, &EventFn](auto *ConcreteGeometry) {
+        generateEvents(*ConcreteGeometry, EventFn);
+      },
+      ConcreteGeom);
+}
 
-  /// Traverse readouts, calculate pixels
-  for (auto &Data : CaenParser.Result) {
+template <typename GeometryType, typename Function>
+void CaenInstrument::generateEvents(const GeometryType &ConcreteGeom,
+                                    Function &&EventFn) {
+  /// Validate readouts and collect their event times
+  Batch.Readouts.clear();
+  Batch.TimeHigh.clear();
+  Batch.TimeLow.clear();
+  for (auto &Data : CaenParser.readouts()) {
     XTRACE(DATA, DEB, "Fiber %u, FEN %u", Data.FiberId, Data.FENId);
-    bool validData = Geom->validateReadoutData(Data);
+    bool validData = ConcreteGeom.validateReadoutData(Data);
     if (not validData) {
       XTRACE(DATA, WAR, "Invalid Data, skipping readout");
       continue;
     }
+    Batch.Readouts.push_back(&Data);
+    Batch.TimeHigh.push_back(Data.TimeHigh);
+    Batch.TimeLow.push_back(Data.TimeLow);
+  }
+
+  // Calculate TOF in ns for all valid readouts at once
+  size_t Count = Batch.Readouts.size();
+  Batch.TOF.resize(Count);
+  Batch.TOFValid.resize(Count);
+  ESSHeaderParser.Packet.Time.getTOFs(Batch.TimeHigh.data(),
+                                      Batch.TimeLow.data(), Count,
+                                      Batch.TOF.data(), Batch.TOFValid.data());
 
-    // Calculate TOF in ns
-    auto TimeOfFlight = ESSHeaderParser.Packet.Time.getTOF(
-        ESSTime(Data.TimeHigh, Data.TimeLow));
+  /// Calculate pixels
+  for (size_t i = 0; i < Count; i++) {
+    auto &Data = *Batch.Readouts[i];
+    uint64_t TimeOfFlight = Batch.TOF[i];
 
-    if (not TimeOfFlight.has_value()) {
+    if (not Batch.TOFValid[i]) {
       XTRACE(DATA, WAR, "No valid TOF from PulseTime or PrevPulseTime");
       continue;
     }
@@ -98,39 +127,70 @@ void CaenInstrument::processReadouts() {
            "PulseTime     %" PRIu64 ", Previous PulseTime: %" PRIu64
            ", Calculated ToF %" PRIu64 " ",
            ESSHeaderParser.Packet.Time.getRefTimeUInt64(),
-           ESSHeaderParser.Packet.Time.getPrevRefTimeUInt64(), TimeOfFlight.value());
+           ESSHeaderParser.Packet.Time.getPrevRefTimeUInt64(), TimeOfFlight);
 
     XTRACE(DATA, DEB,
            "  Data: time (%10u, %10u) tof %llu, Unused %u, Group %u, A %d, B "
            "%d, C %d, D %d",
-           Data.TimeHigh, Data.TimeLow, TimeOfFlight.value(), Data.Unused, Data.Group,
+           Data.TimeHigh, Data.TimeLow, TimeOfFlight, Data.Unused, Data.Group,
            Data.AmpA, Data.AmpB, Data.AmpC, Data.AmpD);
 
-    // Calculate pixel using template wrapper with automatic error counting
-    uint32_t PixelId = Geom->calcPixel(Data);
+    // Calculate pixel using template wrapper with automatic error counting,
+    // calls of a final geometry type are resolved at compile time
+    uint32_t PixelId;
+    if constexpr (std::is_final_v<GeometryType>) {
+      PixelId = ConcreteGeom.template calcPixelStatic<GeometryType>(Data);
+    } else {
+      PixelId = ConcreteGeom.calcPixel(Data);
+    }
 
     // Determine the correct serializer for this pixel
-    auto SerializerId = Geom->calcSerializer(Data);
+    auto SerializerId = ConcreteGeom.calcSerializer(Data);
 
     if (PixelId == 0) {
       XTRACE(DATA, DEB,
              "Pixel Error  Data: time (%10u, %10u) tof %llu, SeqNo %u, Group "
              "%u, A %u, B "
              "%u, C %u, D %u",
-             Data.TimeHigh, Data.TimeLow, TimeOfFlight.value(), Data.Unused, Data.Group,
+             Data.TimeHigh, Data.TimeLow, TimeOfFlight, Data.Unused, Data.Group,
              Data.AmpA, Data.AmpB, Data.AmpC, Data.AmpD);
       // PixelErrors are now counted automatically by DetectorGeometry::calcPixel()
-    } else if (SerializerId >= Serializers.size()) {
+      continue;
+    }
+
+    EventFn(SerializerId, static_cast<int32_t>(TimeOfFlight),
+            static_cast<int32_t>(PixelId));
+  } // for()
+}
+
+void CaenInstrument::processReadouts() {
+  XTRACE(DATA, DEB, "Reference time is %" PRIi64,
+         ESSHeaderParser.Packet.Time.getRefTimeUInt64());
+  /// \todo sometimes PrevPulseTime maybe?
+  auto packet_ref_time =
+      static_cast<int64_t>(ESSHeaderParser.Packet.Time.getRefTimeUInt64());
+  for (auto &Serializer : Serializers)
+    Serializer->checkAndSetReferenceTime(packet_ref_time);
+
+  dispatchEvents([this](size_t SerializerId, int32_t TimeOfFlight,
+                        int32_t PixelId) {
+    if (SerializerId >= Serializers.size()) {
       XTRACE(EVENT, WAR, "Serializer identification error");
       counters.SerializerErrors++;
-    } else {
-      XTRACE(EVENT, DEB, "Pixel %u, TOF %u", PixelId, TimeOfFlight.value());
-      Serializers[SerializerId]->addEvent(static_cast<int32_t>(TimeOfFlight.value()),
-                                          static_cast<int32_t>(PixelId));
-      counters.Events++;
+      return;
     }
+    XTRACE(EVENT, DEB, "Pixel %u, TOF %u", PixelId, TimeOfFlight);
+    Serializers[SerializerId]->addEvent(TimeOfFlight, PixelId);
+    counters.Events++;
+  });
+}
 
-  } // for()
+void CaenInstrument::processReadouts(std::vector<Event> &Events) {
+  Events.clear();
+  dispatchEvents([&Events](size_t SerializerId, int32_t TimeOfFlight,
+                           int32_t PixelId) {
+    Events.push_back({SerializerId, TimeOfFlight, PixelId});
+  });
 }
 
 } // namespace caen
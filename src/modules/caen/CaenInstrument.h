@@ -22,6 +22,7 @@
 #include <miracles/geometry/MiraclesGeometry.h>
 #include <readout/DataParser.h>
 #include <tbl3he/geometry/Tbl3HeGeometry.h>
+#include <variant>
 
 namespace caen {
 
@@ -32,6 +33,16 @@ private:
   BaseSettings &Settings;
   ess_readout::Parser &ESSHeaderParser;
   Config CaenConfiguration;
+
+  /// \brief the geometry as its concrete type, which selects the instance of
+  /// generateEvents() calling the geometry without virtual dispatch.
+  /// Geometry * is used for virtual calls, BIFROST showed no gain without
+  /// them. Always points to the same object as Geom
+  using GeometryVariant =
+      std::variant<Geometry *, LokiGeometry *, MiraclesGeometry *,
+                   CspecGeometry *, Tbl3HeGeometry *>;
+  GeometryVariant ConcreteGeom;
+
   std::vector<std::shared_ptr<EV44Serializer>> Serializers;
   LokiConfig config;
 
@@ -45,19 +56,71 @@ public:
 
   ~CaenInstrument();
 
+  /// \brief Event calculated from a readout, not yet serialized
+  struct Event {
+    size_t SerializerId;
+    int32_t TimeOfFlight;
+    int32_t PixelId;
+  };
+
   /// \brief Generates Events from Readouts, and adds them to a serializer
   void processReadouts();
 
+  /// \brief Generates Events from Readouts without serializing them, used
+  /// by worker threads. The caller is responsible for setting the reference
+  /// time on the serializers and for checking the serializer ids
+  /// \param Events cleared, then filled with the events of the current packet
+  void processReadouts(std::vector<Event> &Events);
+
   /// \brief Set All serializers at once
   void
   setSerializers(std::vector<std::shared_ptr<EV44Serializer>> &serializers) {
     Serializers = serializers;
   }
 
+  /// \brief call the geometry through the Geometry base class only, used
+  /// by tests to compare with the calls without virtual dispatch
+  void useVirtualGeometry() { ConcreteGeom = Geom; }
+
+  /// \brief true unless the geometry is called through the base class
+  bool isConcreteGeometry() const {
+    return not std::holds_alternative<Geometry *>(ConcreteGeom);
+  }
+
   /// \brief Stuff that 'ties' Caen together
 
   DataParser CaenParser;
-  Geometry *Geom;
+  Geometry *const Geom;
+
+private:
+  /// \brief load and parse the configuration file
+  static Config loadConfig(const std::string &ConfigFile);
+
+  /// \brief create the geometry of the named detector
+  /// \throws std::runtime_error for unknown detector names
+  static GeometryVariant createGeometry(Statistics &Stats,
+                                        const std::string &DetectorName,
+                                        Config &CaenConfiguration);
+
+  /// Validated readouts of the current packet and their TOFs, kept between
+  /// packets to avoid allocations
+  struct {
+    std::vector<const DataParser::CaenReadout *> Readouts;
+    std::vector<uint32_t> TimeHigh;
+    std::vector<uint32_t> TimeLow;
+    std::vector<uint64_t> TOF;
+    std::vector<uint8_t> TOFValid;
+  } Batch;
+
+  /// \brief call generateEvents() for the concrete geometry type
+  template <typename Function> void dispatchEvents(Function &&EventFn);
+
+  /// \brief Traverse readouts, calculate pixels and pass valid events to
+  /// EventFn(SerializerId, TimeOfFlight, PixelId)
+  /// \tparam GeometryType concrete (final) geometry type of Geom, or
+  /// Geometry for virtual calls
+  template <typename GeometryType, typename Function>
+  void generateEvents(const GeometryType &ConcreteGeom, Function &&EventFn);
 };
 
 } // namespace caen
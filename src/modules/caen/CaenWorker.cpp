@@ -0,0 +1,78 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Implementation of the worker for multi-threaded Caen processing
+///
+//===----------------------------------------------------------------------===//
+
+#include <caen/CaenWorker.h>
+#include <common/debug/Trace.h>
+
+// #undef TRC_LEVEL
+// #define TRC_LEVEL TRC_L_DEB
+
+namespace caen {
+
+CaenWorker::CaenWorker(BaseSettings &Settings)
+    : FirstInstrumentStat(Stats.size() + 1),
+      Caen(Stats, Counters, Settings, ESSHeaderParser), Jobs(JobSlots),
+      TodoWait(WaitStrategy::modeFromString(Settings.ProcessingWait),
+               Settings.ProcessingWaitTimeoutUS) {
+  // Readouts are processed before the job is reused
+  Caen.CaenParser.setInPlace(true);
+  for (auto &Job : Jobs) {
+    Job.Data.reserve(Settings.ReceiveMaxBytes);
+    Job.Events.reserve(Caen.CaenParser.MaxReadoutsInPacket);
+  }
+}
+
+void CaenWorker::submit(const ess_readout::Parser::PacketDataV0 &Packet) {
+  unsigned Slot = NextSlot;
+  NextSlot = (NextSlot + 1) % JobSlots;
+
+  auto &Job = Jobs[Slot];
+  Job.Data.assign(Packet.DataPtr, Packet.DataPtr + Packet.DataLength);
+  Job.PulseTime = esstime::ESSTime(Packet.HeaderPtr.getPulseHigh(),
+                                   Packet.HeaderPtr.getPulseLow());
+  Job.PrevPulseTime = esstime::ESSTime(Packet.HeaderPtr.getPrevPulseHigh(),
+                                       Packet.HeaderPtr.getPrevPulseLow());
+
+  // Cannot fail, at most JobSlots jobs are in flight
+  Todo.push(Slot);
+  InFlight++;
+  TodoWait.notify();
+}
+
+CaenWorker::Job *CaenWorker::popCompleted() {
+  unsigned Slot;
+  if (not Done.pop(Slot)) {
+    return nullptr;
+  }
+  InFlight--;
+  return &Jobs[Slot];
+}
+
+bool CaenWorker::processNext() {
+  unsigned Slot;
+  if (not Todo.pop(Slot)) {
+    return false;
+  }
+
+  auto &Job = Jobs[Slot];
+  ESSHeaderParser.Packet.Time.setReference(Job.PulseTime);
+  ESSHeaderParser.Packet.Time.setPrevReference(Job.PrevPulseTime);
+  Caen.CaenParser.parse(Job.Data.data(), Job.Data.size());
+  Caen.processReadouts(Job.Events);
+  XTRACE(DATA, DEB, "Slot %u: %zu events", Slot, Job.Events.size());
+
+  Done.push(Slot);
+  return true;
+}
+
+void CaenWorker::waitForWork() {
+  TodoWait.wait([this]() { return not Todo.wasEmpty(); });
+}
+
+} // namespace caen
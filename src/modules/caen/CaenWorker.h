@@ -0,0 +1,88 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Worker for multi-threaded Caen processing
+///
+/// The processing thread validates the ESS header and hands the packet to a
+/// worker selected by OutputQueue. Each worker owns its own readout parser,
+/// geometry, calibration and stats, and calculates events into the job.
+/// Completed jobs are collected by the processing thread in dispatch order,
+/// which then does all serialization. Serializers therefore see the same
+/// sequence of reference times and events as in single-threaded processing.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <caen/CaenCounters.h>
+#include <caen/CaenInstrument.h>
+#include <common/Statistics.h>
+#include <common/memory/SPSCFifo.h>
+#include <common/readout/ess/Parser.h>
+#include <common/system/WaitStrategy.h>
+#include <vector>
+
+namespace caen {
+
+class CaenWorker {
+public:
+  /// Max number of packets in flight per worker
+  static constexpr unsigned JobSlots{64};
+
+  /// \brief A packet and the events calculated from it
+  struct Job {
+    std::vector<char> Data;
+    esstime::ESSTime PulseTime;
+    esstime::ESSTime PrevPulseTime;
+    std::vector<CaenInstrument::Event> Events;
+  };
+
+  /// \brief load configuration and calibration, throws like CaenInstrument
+  CaenWorker(BaseSettings &Settings);
+
+  // Dispatcher (processing thread) side
+
+  /// \brief no free job slots, wait for completed jobs first
+  bool full() const { return InFlight == JobSlots; }
+
+  /// \brief no jobs queued or being processed
+  bool idle() const { return InFlight == 0; }
+
+  /// \brief copy payload and pulse times of a validated packet into a free
+  /// job slot and queue it. Must not be called when full()
+  void submit(const ess_readout::Parser::PacketDataV0 &Packet);
+
+  /// \brief oldest completed job, in submit order
+  /// \return nullptr if no job has completed yet. The job is valid until
+  /// the next call to submit()
+  Job *popCompleted();
+
+  // Worker thread side
+
+  /// \brief parse the next queued packet and calculate its events
+  /// \return false if there was no queued packet
+  bool processNext();
+
+  /// \brief wait for a packet to be submitted
+  void waitForWork();
+
+  /// Private stats, summed into the detector stats by CaenBase
+  Statistics Stats;
+  ess_readout::Parser ESSHeaderParser{Stats};
+  /// Index of the first stat registered by the instrument (1-based)
+  size_t FirstInstrumentStat;
+  CaenCounters Counters;
+  CaenInstrument Caen;
+
+private:
+  std::vector<Job> Jobs;
+  memory_relaxed_acquire_release::CircularFifo<unsigned, JobSlots> Todo;
+  memory_relaxed_acquire_release::CircularFifo<unsigned, JobSlots> Done;
+  WaitStrategy TodoWait;
+
+  unsigned NextSlot{0}; ///< dispatcher only
+  unsigned InFlight{0}; ///< dispatcher only
+};
+
+} // namespace caen
@@ -14,6 +14,7 @@
 #include <common/debug/Trace.h>
 #include <modules/caen/geometry/CDCalibration.h>
 #include <modules/caen/geometry/Interval.h>
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -38,11 +39,11 @@ CDCalibration::CDCalibration(const std::string &Name, const std::string &Calibra
 }
 
 double CDCalibration::posCorrection(int Group, int Unit, double Pos) const {
-  const std::vector<double> &Pols = Calibration[Group][Unit];
-  double a = Pols[0];
-  double b = Pols[1];
-  double c = Pols[2];
-  double d = Pols[3];
+  const Polynomial &Pol = Calibration.get(Group, Unit);
+  double a = Pol[0];
+  double b = Pol[1];
+  double c = Pol[2];
+  double d = Pol[3];
 
   double Delta = a + Pos * (b + Pos * (c + Pos * d));
   XTRACE(EVENT, DEB, "group %d, unit %d, pos: %g, delta %g", Group, Unit, Pos,
@@ -64,6 +65,28 @@ double CDCalibration::posCorrection(int Group, int Unit, double Pos) const {
   return CorrectedPos;
 }
 
+void CDCalibration::PolynomialTable::push_back(
+    const std::vector<std::vector<double>> &GroupPolys) {
+  // A wider group than seen before, move the existing groups apart
+  if (GroupPolys.size() > UnitsPerGroup) {
+    std::vector<Polynomial> Wider(Groups * GroupPolys.size());
+    for (size_t Group = 0; Group < Groups; Group++) {
+      std::copy_n(Table.begin() + Group * UnitsPerGroup, UnitsPerGroup,
+                  Wider.begin() + Group * GroupPolys.size());
+    }
+    Table.swap(Wider);
+    UnitsPerGroup = GroupPolys.size();
+  }
+
+  Table.resize((Groups + 1) * UnitsPerGroup);
+  for (size_t Unit = 0; Unit < GroupPolys.size(); Unit++) {
+    auto &Coefficients = Table[Groups * UnitsPerGroup + Unit].Coefficients;
+    size_t Count = std::min(Coefficients.size(), GroupPolys[Unit].size());
+    std::copy_n(GroupPolys[Unit].begin(), Count, Coefficients.begin());
+  }
+  Groups++;
+}
+
 ///\brief
 int CDCalibration::getUnitId(int GroupIndex, double GlobalPos) const {
   XTRACE(EVENT, DEB, "GroupIndex %u GlobalPos %f", GroupIndex, GlobalPos);
@@ -12,7 +12,9 @@
 #pragma once
 
 #include <common/JsonFile.h>
+#include <array>
 #include <string>
+#include <vector>
 
 // #undef TRC_LEVEL
 // #define TRC_LEVEL TRC_L_DEB
@@ -48,8 +50,54 @@ public:
   /// \brief intervals are vectors of vectors
   std::vector<std::vector<std::pair<double, double>>> Intervals;
 
-  /// \brief coefficients are vectors of vectors of vectors
-  std::vector<std::vector<std::vector<double>>> Calibration;
+  /// \brief coefficients a + b x + c x^2 + d x^3 of one polynomial, aligned
+  /// so that each polynomial is in a single cache line
+  struct alignas(32) Polynomial {
+    std::array<double, 4> Coefficients{};
+
+    double operator[](size_t Power) const { return Coefficients[Power]; }
+  };
+
+  /// \brief all polynomials in one contiguous table, the polynomial of
+  /// Group, Unit is at index Group * UnitsPerGroup + Unit. Indexed like the
+  /// nested vectors it replaces: Calibration[Group][Unit][Power]
+  class PolynomialTable {
+  public:
+    /// \brief the polynomials of one group
+    class GroupView {
+    public:
+      GroupView(const Polynomial *First, size_t Units)
+          : First(First), Units(Units) {}
+      const Polynomial &operator[](size_t Unit) const { return First[Unit]; }
+      size_t size() const { return Units; }
+
+    private:
+      const Polynomial *First;
+      size_t Units;
+    };
+
+    /// \brief append the polynomials of the next group. Groups with fewer
+    /// polynomials than the widest group are padded with zero polynomials
+    void push_back(const std::vector<std::vector<double>> &GroupPolys);
+
+    GroupView operator[](size_t Group) const {
+      return {&Table[Group * UnitsPerGroup], UnitsPerGroup};
+    }
+
+    const Polynomial &get(int Group, int Unit) const {
+      return Table[Group * UnitsPerGroup + Unit];
+    }
+
+    size_t size() const { return Groups; }
+
+  private:
+    size_t Groups{0};
+    size_t UnitsPerGroup{0};
+    std::vector<Polynomial> Table;
+  };
+
+  /// \brief coefficients for each group and unit
+  PolynomialTable Calibration;
 
   // Grafana Counters
   struct Stats {
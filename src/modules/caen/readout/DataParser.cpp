@@ -20,6 +20,10 @@ constexpr unsigned int CaenReadoutSize{sizeof(DataParser::CaenReadout)};
 // Assume we start after the PacketHeader
 int DataParser::parse(const char *Buffer, unsigned int Size) {
   Result.clear();
+  // Readouts have a fixed size and parsing stops at the first error, so the
+  // valid readouts are always consecutive from the start of the buffer
+  InPlaceReadouts = (const CaenReadout *)Buffer;
+  InPlaceCount = 0;
   unsigned int ParsedReadouts = 0;
 
   unsigned int BytesLeft = Size;
@@ -71,7 +75,11 @@ int DataParser::parse(const char *Buffer, unsigned int Size) {
     ParsedReadouts++;
     Stats.Readouts++;
 
-    Result.push_back(*Data);
+    if (ParseInPlace) {
+      InPlaceCount++;
+    } else {
+      Result.push_back(*Data);
+    }
     BytesLeft -= Data->DataLength;
     DataPtr += Data->DataLength;
   }
@@ -0,0 +1,96 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief Charge division position correction with the nested coefficient
+/// vectors versus the contiguous polynomial table
+///
+/// Uses a LOKI sized calibration with random polynomials and random
+/// group, unit and position per readout.
+
+#include <benchmark/benchmark.h>
+#include <caen/geometry/CDCalibration.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace caen;
+
+static constexpr int Groups{896}; // 8 banks of 112 tubes
+static constexpr int GroupSize{7};
+static constexpr size_t Readouts{500};
+
+struct Setup {
+  CDCalibration Calib{"loki"};
+  std::vector<std::vector<std::vector<double>>> Nested;
+  std::vector<int> Group;
+  std::vector<int> Unit;
+  std::vector<double> Pos;
+
+  Setup() {
+    std::mt19937 Random(42);
+    std::uniform_real_distribution<double> Coefficient(-0.01, 0.01);
+    for (int g = 0; g < Groups; g++) {
+      std::vector<std::vector<double>> GroupPolys;
+      for (int u = 0; u < GroupSize; u++) {
+        GroupPolys.push_back({Coefficient(Random), Coefficient(Random),
+                              Coefficient(Random), Coefficient(Random)});
+      }
+      Calib.Calibration.push_back(GroupPolys);
+      Nested.push_back(GroupPolys);
+    }
+
+    std::uniform_int_distribution<int> GroupDist(0, Groups - 1);
+    std::uniform_int_distribution<int> UnitDist(0, GroupSize - 1);
+    std::uniform_real_distribution<double> PosDist(0.0, 1.0);
+    for (size_t i = 0; i < Readouts; i++) {
+      Group.push_back(GroupDist(Random));
+      Unit.push_back(UnitDist(Random));
+      Pos.push_back(PosDist(Random));
+    }
+  }
+};
+
+/// Previous implementation, reading the nested coefficient vectors
+static void NestedPositions(benchmark::State &state) {
+  Setup S;
+  std::vector<double> Corrected(Readouts);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < Readouts; i++) {
+      const std::vector<double> &Pols = S.Nested[S.Group[i]][S.Unit[i]];
+      double Pos = S.Pos[i];
+      double Delta =
+          Pols[0] + Pos * (Pols[1] + Pos * (Pols[2] + Pos * Pols[3]));
+      double CorrectedPos = Pos - Delta;
+      if (CorrectedPos < 0.0) {
+        CorrectedPos = 0.0;
+        S.Calib.Stats.ClampLow++;
+      } else if (CorrectedPos > 1.0) {
+        CorrectedPos = 1.0;
+        S.Calib.Stats.ClampHigh++;
+      }
+      Corrected[i] = CorrectedPos;
+    }
+    benchmark::DoNotOptimize(Corrected.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(NestedPositions);
+
+static void TablePositions(benchmark::State &state) {
+  Setup S;
+  std::vector<double> Corrected(Readouts);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < Readouts; i++) {
+      Corrected[i] = S.Calib.posCorrection(S.Group[i], S.Unit[i], S.Pos[i]);
+    }
+    benchmark::DoNotOptimize(Corrected.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(TablePositions);
+
+BENCHMARK_MAIN();
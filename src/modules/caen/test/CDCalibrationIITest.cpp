@@ -84,6 +84,33 @@ TEST_F(CalibrationIITest, SelectedValues) {
   ASSERT_EQ(calib.Stats.ClampHigh, 1);
 }
 
+TEST_F(CalibrationIITest, PolynomialTable) {
+  calib.parseCalibration();
+  ASSERT_EQ(calib.Calibration.size(), 4);
+  ASSERT_EQ(calib.Calibration[1].size(), 1);
+  ASSERT_EQ(calib.Calibration[1][0][0], 1.0);
+  ASSERT_EQ(calib.Calibration[2][0][1], 1.0);
+  ASSERT_EQ(calib.Calibration[3][0][0], -1.0);
+  ASSERT_EQ(calib.Calibration[3][0][3], 0.0);
+}
+
+// Groups added directly are usable without loading a file, a wider group
+// keeps the polynomials of the groups before it
+TEST_F(CalibrationIITest, PolynomialTablePushBack) {
+  CDCalibration Calib{"dummy"};
+  Calib.Calibration.push_back({{0.1, 0.0, 0.0, 0.0}});
+  Calib.Calibration.push_back({{0.2, 0.0, 0.0, 0.0}, {0.3, 0.0, 0.0, 0.0}});
+  ASSERT_EQ(Calib.Calibration.size(), 2);
+  ASSERT_EQ(Calib.Calibration[0].size(), 2);
+  ASSERT_EQ(Calib.Calibration[0][0][0], 0.1);
+  ASSERT_EQ(Calib.Calibration[0][1][0], 0.0);
+  ASSERT_EQ(Calib.Calibration[1][0][0], 0.2);
+  ASSERT_EQ(Calib.Calibration[1][1][0], 0.3);
+
+  ASSERT_NEAR(Calib.posCorrection(0, 0, 0.5), 0.4, 0.000001);
+  ASSERT_NEAR(Calib.posCorrection(1, 1, 0.5), 0.2, 0.000001);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   auto retval = RUN_ALL_TESTS();
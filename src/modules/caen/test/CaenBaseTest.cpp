@@ -209,6 +209,32 @@ TEST_F(CaenBaseTest, DataReceiveGoodLoki) {
   Readout.stopThreads();
 }
 
+TEST_F(CaenBaseTest, DataReceiveGoodLokiWorkers) {
+  Settings.ProcessingWorkers = 2;
+  caen::CaenBase Readout(Settings, DetectorType::LOKI);
+
+  writePacketToRxFIFO(Readout, TestPacket2);
+
+  // Same results as single threaded processing, summed over the workers
+  EXPECT_EQ(Readout.Counters.Parser.Readouts, 6);
+  EXPECT_EQ(Readout.Counters.Parser.DataHeaders, 6);
+  EXPECT_EQ(Readout.getStatValueByName(
+                DetectorGeometry<CaenReadout>::METRIC_PIXEL_ERRORS),
+            1);
+  EXPECT_EQ(Readout.getStatValueByName(
+                DetectorGeometry<CaenReadout>::METRIC_VALIDATION_ERRORS),
+            2);
+  EXPECT_EQ(
+      Readout.getStatValueByName(Parser::METRIC_EVENTS_TIMESTAMP_TOF_HIGH), 1);
+  EXPECT_EQ(Readout.getStatValueByName(
+                Parser::METRIC_EVENTS_TIMESTAMP_PREVTOF_NEGATIVE),
+            1);
+  EXPECT_EQ(Readout.Counters.Events, 1);
+
+  EXPECT_NE(Readout.Counters.ProcessingIdle, 0);
+  Readout.stopThreads();
+}
+
 TEST_F(CaenBaseTest, DataReceiveGoodBifrostForceUpdate) {
   XTRACE(DATA, DEB, "Running DataReceiveGood test");
   Settings.DetectorName = "bifrost";
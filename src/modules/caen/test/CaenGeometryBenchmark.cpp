@@ -0,0 +1,133 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief Readout processing per CAEN geometry, calling the geometry through
+/// the Geometry base class versus through the concrete (final) type
+///
+/// Each iteration validates the readouts, calculates pixels and serializer
+/// indexes like CaenInstrument. Readouts are random, only those giving a
+/// pixel are used.
+
+#include <benchmark/benchmark.h>
+#include <bifrost/geometry/BifrostGeometry.h>
+#include <caen/geometry/Config.h>
+#include <common/Statistics.h>
+#include <cspec/geometry/CspecGeometry.h>
+#include <loki/geometry/LokiGeometry.h>
+#include <memory>
+#include <miracles/geometry/MiraclesGeometry.h>
+#include <random>
+#include <tbl3he/geometry/Tbl3HeGeometry.h>
+#include <vector>
+
+using namespace caen;
+
+static constexpr size_t Readouts{1000};
+
+template <typename GeometryType> struct Files {};
+template <> struct Files<LokiGeometry> {
+  static constexpr const char *Name{"loki"};
+  static constexpr const char *Config{LOKI_CONFIG};
+  static constexpr const char *Calib{LOKI_CALIB};
+};
+template <> struct Files<BifrostGeometry> {
+  static constexpr const char *Name{"bifrost"};
+  static constexpr const char *Config{BIFROST_CONFIG};
+  static constexpr const char *Calib{BIFROST_CALIB};
+};
+template <> struct Files<MiraclesGeometry> {
+  static constexpr const char *Name{"miracles"};
+  static constexpr const char *Config{MIRACLES_CONFIG};
+  static constexpr const char *Calib{MIRACLES_CALIB};
+};
+template <> struct Files<CspecGeometry> {
+  static constexpr const char *Name{"cspec"};
+  static constexpr const char *Config{CSPEC_CONFIG};
+  static constexpr const char *Calib{CSPEC_CALIB};
+};
+template <> struct Files<Tbl3HeGeometry> {
+  static constexpr const char *Name{"tbl3he"};
+  static constexpr const char *Config{TBL3HE_CONFIG};
+  static constexpr const char *Calib{TBL3HE_CALIB};
+};
+
+template <typename GeometryType> struct Setup {
+  Statistics Stats;
+  Config CaenConfig{Files<GeometryType>::Config};
+  std::unique_ptr<GeometryType> Geom;
+  std::vector<DataParser::CaenReadout> Data;
+
+  Setup() {
+    CaenConfig.parseConfig();
+    Geom = std::make_unique<GeometryType>(Stats, CaenConfig);
+    Geom->CaenCDCalibration = CDCalibration(Files<GeometryType>::Name,
+                                            Files<GeometryType>::Calib);
+    Geom->CaenCDCalibration.parseCalibration();
+
+    std::mt19937 Random(42);
+    std::uniform_int_distribution<int> Fiber(0, 23);
+    std::uniform_int_distribution<int> FEN(0, 23);
+    std::uniform_int_distribution<int> Group(0, 255);
+    std::uniform_int_distribution<int> Amplitude(0, 4000);
+    for (int Tries = 0; Tries < 10'000'000 and Data.size() < Readouts;
+         Tries++) {
+      DataParser::CaenReadout Readout{};
+      Readout.FiberId = Fiber(Random);
+      Readout.FENId = FEN(Random);
+      Readout.Group = Group(Random);
+      Readout.AmpA = Amplitude(Random);
+      Readout.AmpB = Amplitude(Random);
+      Readout.AmpC = Amplitude(Random);
+      Readout.AmpD = Amplitude(Random);
+      if (Geom->validateReadoutData(Readout) and Geom->calcPixel(Readout)) {
+        Data.push_back(Readout);
+      }
+    }
+  }
+};
+
+template <typename GeometryType>
+static void VirtualGeometry(benchmark::State &state) {
+  Setup<GeometryType> S;
+  const Geometry &Geom = *S.Geom;
+
+  for (auto _ : state) {
+    for (auto &Readout : S.Data) {
+      if (Geom.validateReadoutData(Readout)) {
+        benchmark::DoNotOptimize(Geom.calcPixel(Readout));
+        benchmark::DoNotOptimize(Geom.calcSerializer(Readout));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * S.Data.size());
+}
+
+template <typename GeometryType>
+static void StaticGeometry(benchmark::State &state) {
+  Setup<GeometryType> S;
+  const GeometryType &Geom = *S.Geom;
+
+  for (auto _ : state) {
+    for (auto &Readout : S.Data) {
+      if (Geom.validateReadoutData(Readout)) {
+        benchmark::DoNotOptimize(
+            Geom.template calcPixelStatic<GeometryType>(Readout));
+        benchmark::DoNotOptimize(Geom.calcSerializer(Readout));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * S.Data.size());
+}
+
+BENCHMARK_TEMPLATE(VirtualGeometry, LokiGeometry);
+BENCHMARK_TEMPLATE(StaticGeometry, LokiGeometry);
+BENCHMARK_TEMPLATE(VirtualGeometry, BifrostGeometry);
+BENCHMARK_TEMPLATE(StaticGeometry, BifrostGeometry);
+BENCHMARK_TEMPLATE(VirtualGeometry, MiraclesGeometry);
+BENCHMARK_TEMPLATE(StaticGeometry, MiraclesGeometry);
+BENCHMARK_TEMPLATE(VirtualGeometry, CspecGeometry);
+BENCHMARK_TEMPLATE(StaticGeometry, CspecGeometry);
+BENCHMARK_TEMPLATE(VirtualGeometry, Tbl3HeGeometry);
+BENCHMARK_TEMPLATE(StaticGeometry, Tbl3HeGeometry);
+
+BENCHMARK_MAIN();
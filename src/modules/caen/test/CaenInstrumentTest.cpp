@@ -107,6 +107,26 @@ TEST_F(CaenInstrumentTest, LokiGoodEvent) {
   EXPECT_EQ(parser.Packet.Time.Counters.TofCount, 1);
 }
 
+TEST_F(CaenInstrumentTest, LokiGoodEventNoSerializers) {
+  Settings.CalibFile = LOKI_CALIB;
+  CaenInstrument Caen(stats, counters, Settings, parser);
+
+  Caen.CaenParser.Result.clear();
+  Caen.CaenParser.Result.push_back(readout);
+  parser.Packet.Time.setReference(ess_readout::ESSTime(1000, 0));
+
+  // Events are returned instead of serialized
+  std::vector<CaenInstrument::Event> Events{{5, 5, 5}};
+  Caen.processReadouts(Events);
+
+  ASSERT_EQ(Events.size(), 1);
+  EXPECT_EQ(Events[0].SerializerId, 0);
+  EXPECT_GE(Events[0].TimeOfFlight, 0);
+  EXPECT_GT(Events[0].PixelId, 0);
+  EXPECT_EQ(counters.Events, 0);
+  EXPECT_EQ(parser.Packet.Time.Counters.TofCount, 1);
+}
+
 TEST_F(CaenInstrumentTest, BifrostGoodEvent) {
   Settings.ConfigFile = BIFROST_CONFIG;
   Settings.CalibFile = BIFROST_CALIB;
@@ -304,6 +324,48 @@ TEST_F(CaenInstrumentTest, HighTOFError) {
   EXPECT_EQ(counters.Events, 0);
 }
 
+// Geometry called without virtual dispatch gives the same events and
+// geometry counters as the virtual calls
+TEST_F(CaenInstrumentTest, StaticSameAsVirtualGeometry) {
+  Settings.CalibFile = LOKI_CALIB;
+  CaenInstrument Caen(stats, counters, Settings, parser);
+  ASSERT_TRUE(Caen.isConcreteGeometry());
+
+  Caen.CaenParser.Result.clear();
+  for (int Group = 0; Group < 20; Group++) {
+    for (int Amp = 0; Amp < 40; Amp += 3) {
+      readout.Group = Group;
+      readout.AmpA = Amp;
+      readout.AmpB = 40 - Amp;
+      readout.AmpC = Amp / 2;
+      readout.FENId = Group / 4;
+      Caen.CaenParser.Result.push_back(readout);
+    }
+  }
+  parser.Packet.Time.setReference(ess_readout::ESSTime(1000, 0));
+
+  auto &Counters = Caen.Geom->getBaseCounters();
+  std::vector<CaenInstrument::Event> StaticEvents;
+  Caen.processReadouts(StaticEvents);
+  int64_t StaticPixelErrors = Counters.PixelErrors;
+  int64_t StaticValidationErrors = Counters.ValidationErrors;
+
+  Caen.useVirtualGeometry();
+  ASSERT_FALSE(Caen.isConcreteGeometry());
+  std::vector<CaenInstrument::Event> VirtualEvents;
+  Caen.processReadouts(VirtualEvents);
+
+  ASSERT_NE(StaticEvents.size(), 0);
+  ASSERT_EQ(StaticEvents.size(), VirtualEvents.size());
+  for (size_t i = 0; i < StaticEvents.size(); i++) {
+    EXPECT_EQ(StaticEvents[i].SerializerId, VirtualEvents[i].SerializerId);
+    EXPECT_EQ(StaticEvents[i].TimeOfFlight, VirtualEvents[i].TimeOfFlight);
+    EXPECT_EQ(StaticEvents[i].PixelId, VirtualEvents[i].PixelId);
+  }
+  EXPECT_EQ(Counters.PixelErrors, 2 * StaticPixelErrors);
+  EXPECT_EQ(Counters.ValidationErrors, 2 * StaticValidationErrors);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
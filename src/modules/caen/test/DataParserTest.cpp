@@ -116,6 +116,22 @@ TEST_F(DataParserTest, MultipleDataPackets) {
   ASSERT_EQ(Parser.Result.size(), 2);
 }
 
+TEST_F(DataParserTest, MultipleDataPacketsInPlace) {
+  Parser.parse((char *)&Ok2xCaenReadout[0], Ok2xCaenReadout.size());
+  auto Copies = Parser.Result;
+
+  Parser.setInPlace(true);
+  auto Res = Parser.parse((char *)&Ok2xCaenReadout[0], Ok2xCaenReadout.size());
+  ASSERT_EQ(Res, 2);
+  ASSERT_EQ(Parser.Result.size(), 0);
+
+  auto Readouts = Parser.readouts();
+  ASSERT_EQ(Readouts.size(), 2);
+  EXPECT_EQ((char *)&Readouts[0], (char *)&Ok2xCaenReadout[0]);
+  for (size_t i = 0; i < Readouts.size(); i++) {
+    EXPECT_EQ(memcmp(&Readouts[i], &Copies[i], sizeof(Copies[i])), 0);
+  }
+}
 
 /// \todo confirm this response when passed too many readouts
 TEST_F(DataParserTest, BadThreeReadouts) {
@@ -14,7 +14,7 @@
 #include <common/RuntimeStat.h>
 #include <common/kafka/EV44Serializer.h>
 #include <common/kafka/KafkaConfig.h>
-#include <common/memory/HashMap2D.h>
+#include <common/memory/DenseMap2D.h>
 
 #include <fmt/format.h>
 
@@ -69,8 +69,7 @@ CbmBase::CbmBase(BaseSettings const &settings)
   Stats.create("produce.cause.timeout", Counters.ProduceCauseTimeout);
 
   // clang-format on
-  std::function<void()> inputFunc = [this]() { inputThread(); };
-  AddThreadFunction(inputFunc, "input");
+  addInputThreads();
 
   std::function<void()> processingFunc = [this]() {
     CbmBase::processingThread();
@@ -94,6 +93,9 @@ void CbmBase::processingThread() {
   KafkaConfig KafkaCfg(EFUSettings.KafkaConfigFile);
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
 
   auto Produce = [&EventProducer](const auto &DataBuffer,
                                   const auto &Timestamp) {
@@ -108,7 +110,7 @@ void CbmBase::processingThread() {
 
   // Create serializers
   SchemaMap.reset(
-      new HashMap2D<SchemaDetails>(CbmConfiguration->CbmParms.NumOfFENs));
+      new DenseMap2D<SchemaDetails>(CbmConfiguration->CbmParms.NumOfFENs));
 
   for (auto &Topology : CbmConfiguration->TopologyMapPtr->toValuesList()) {
 
@@ -177,6 +179,8 @@ void CbmBase::processingThread() {
   // production based on the configuration and serializers created above
   CbmInstrument cbmInstrument(Stats, Counters, *CbmConfiguration, *CbmParser,
                               *SchemaMap, ESSHeaderParser);
+  // Readouts are processed before the ring buffer entry is reused
+  CbmParser->setInPlace(true);
 
   // Monitor these counters and time out after one second
   Timer ProduceTimer(EFUSettings.UpdateIntervalSec * 1'000'000'000);
@@ -188,15 +192,15 @@ void CbmBase::processingThread() {
 
     auto idle_start = local_clock::now();
 
-    if (InputFifo.pop(DataIndex)) { // There is data in the FIFO - do processing
-      auto DataLen = RxRingbuffer.getDataLength(DataIndex);
+    if (auto RxRing = popInput(DataIndex)) { // There is data - do processing
+      auto DataLen = RxRing->getDataLength(DataIndex);
       if (DataLen == 0) {
         ITCounters.FifoSeqErrors++;
         continue;
       }
 
       /// \todo use the Buffer<T> class here and in parser
-      auto DataPtr = RxRingbuffer.getDataBuffer(DataIndex);
+      auto DataPtr = RxRing->getDataBuffer(DataIndex);
 
       auto Res = ESSHeaderParser.validate(
           DataPtr, DataLen, CbmConfiguration->Instrument);
@@ -216,9 +220,9 @@ void CbmBase::processingThread() {
       cbmInstrument.processMonitorReadouts();
 
     } else {
-      // There is NO data in the FIFO - increment idle counter and sleep a
-      // little
-      usleep(100);
+      // There is NO data in the FIFO - increment idle counter and wait
+      // for data
+      waitForInput();
       Counters.ProcessingIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
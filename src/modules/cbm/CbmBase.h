@@ -12,7 +12,7 @@
 #include <common/detector/Detector.h>
 #include <common/kafka/EV44Serializer.h>
 #include <common/kafka/serializer/DA00HistogramSerializer.h>
-#include <common/memory/HashMap2D.h>
+#include <common/memory/DenseMap2D.h>
 #include <memory>
 #include <modules/cbm/Counters.h>
 #include <modules/cbm/SchemaDetails.h>
@@ -54,7 +54,7 @@ protected:
   std::unique_ptr<Parser> CbmParser;
 
 private:
-  std::unique_ptr<HashMap2D<SchemaDetails>> SchemaMap;
+  std::unique_ptr<DenseMap2D<SchemaDetails>> SchemaMap;
 };
 
 } // namespace cbm
@@ -21,7 +21,7 @@ namespace cbm {
 /// \brief load configuration and calibration files
 CbmInstrument::CbmInstrument(Statistics &Stats, struct Counters &Counters,
                              Config &Config, Parser &cbmReadoutParser,
-                             const HashMap2D<SchemaDetails> &SchemaDetailMap,
+                             const DenseMap2D<SchemaDetails> &SchemaDetailMap,
                              ess_readout::Parser &essHeaderParser)
     : CbmReadoutParser(cbmReadoutParser), counters(Counters), Conf(Config),
       SchemaMap(SchemaDetailMap), ESSHeaderParser(essHeaderParser),
@@ -52,9 +52,9 @@ void CbmInstrument::processMonitorReadouts() {
   }
 
   XTRACE(DATA, DEB, "processMonitorReadouts() - has %zu entries",
-         CbmReadoutParser.Result.size());
+         CbmReadoutParser.readouts().size());
 
-  for (const auto &Readout : CbmReadoutParser.Result) {
+  for (const auto &Readout : CbmReadoutParser.readouts()) {
 
     XTRACE(DATA, DEB,
            "readout: FiberId %d, FENId %d, POS %d, Type %d, Channel %d, ADC "
@@ -71,8 +71,25 @@ void CbmInstrument::processMonitorReadouts() {
 
     ESSTime ReadoutTime = ESSTime(Readout.TimeHigh, Readout.TimeLow);
 
-    // Check for out_of_range errors thrown by the HashMap2D, which contains
-    // the serializers
+    // Serializer for this FEN and Channel, looked up once a readout is about
+    // to produce an event
+    auto getDetails = [&]() -> const SchemaDetails * {
+      const SchemaDetails *Details =
+          SchemaMap.get(Readout.FENId, Readout.Channel);
+      if (Details == nullptr) {
+        XTRACE(DATA, WAR,
+               "No serializer configured for FEN %" PRIu8 ", Channel %" PRIu8,
+               Readout.FENId, Readout.Channel);
+
+        /// \note: This code should be not be reached if the geometry
+        /// validation is working correctly, and it called before attempting
+        /// to access the serializer. If this is reached, it indicates a bug
+        /// in the readout validation logic.
+        counters.NoSerializerCfgError++;
+      }
+      return Details;
+    };
+
     try {
 
       /// Calculates the time of flight (TOF) for the readout based on the
@@ -98,8 +115,10 @@ void CbmInstrument::processMonitorReadouts() {
         if (Conf.CbmParms.NormalizeIBMReadouts && (Readout.NADC.MCASum != 0)) {
           normADC /= Readout.NADC.MCASum;
         }
-        const SchemaDetails *Details =
-            SchemaMap.get(Readout.FENId, Readout.Channel);
+        const SchemaDetails *Details = getDetails();
+        if (Details == nullptr) {
+          continue;
+        }
         if (Details->GetSchema() == SchemaType::DA00) {
           Details->GetSerializer<SchemaType::DA00>()->addEvent(
               TimeOfFlight.value(), normADC);
@@ -122,7 +141,10 @@ void CbmInstrument::processMonitorReadouts() {
         // Get pixel from geometry (fixed offset configured in topology)
         uint32_t PixelId = CbmGeometry.calcPixel(Readout);
 
-        SchemaDetails *Details = SchemaMap.get(Readout.FENId, Readout.Channel);
+        const SchemaDetails *Details = getDetails();
+        if (Details == nullptr) {
+          continue;
+        }
         if (Details->GetSchema() == SchemaType::DA00) {
           Details->GetSerializer<SchemaType::DA00>()->addEvent(
               TimeOfFlight.value(), 1);
@@ -151,10 +173,13 @@ void CbmInstrument::processMonitorReadouts() {
                  Readout.Type, TimeOfFlight.value(), Readout.Pos.XPos,
                  Readout.Pos.YPos);
         } else {
+          const SchemaDetails *Details = getDetails();
+          if (Details == nullptr) {
+            continue;
+          }
 
-          SchemaMap.get(Readout.FENId, Readout.Channel)
-              ->GetSerializer<SchemaType::EV44>()
-              ->addEvent(TimeOfFlight.value(), PixelId);
+          Details->GetSerializer<SchemaType::EV44>()->addEvent(
+              TimeOfFlight.value(), PixelId);
 
           counters.Event2DEvents++;
 
@@ -170,18 +195,6 @@ void CbmInstrument::processMonitorReadouts() {
         counters.TypeNotConfigured++;
         continue;
       }
-    } catch (std::out_of_range &e) {
-
-      XTRACE(DATA, WAR,
-             "No serializer configured for FEN %" PRIu8 ", Channel %" PRIu8,
-             Readout.FENId, Readout.Channel);
-
-      /// \note: This code should be not be reached if the geometry validation
-      /// is working correctly, and it called before attempting to access the
-      /// serializer. If this is reached, it indicates a bug in the readout
-      /// validation logic.
-      counters.NoSerializerCfgError++;
-      continue;
     } catch (std::invalid_argument &e) {
       XTRACE(DATA, WAR,
              "Invalid CbmType: %" PRIu8 " for readout %" PRIu8
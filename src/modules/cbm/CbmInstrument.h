@@ -11,7 +11,7 @@
 #pragma once
 
 #include <common/Statistics.h>
-#include <common/memory/HashMap2D.h>
+#include <common/memory/DenseMap2D.h>
 #include <modules/cbm/Counters.h>
 #include <modules/cbm/SchemaDetails.h>
 #include <modules/cbm/geometry/Config.h>
@@ -32,12 +32,12 @@ public:
   /// \param Stats Reference to Statistics object for counter registration.
   /// \param counters Reference to the counters for the CBM instrument.
   /// \param Config Reference to the configuration data for the CBM instrument.
-  /// \param SchemaDetailMap Reference to the HashMap2D of Serializers
+  /// \param SchemaDetailMap Reference to the DenseMap2D of Serializers
   /// \param cbmReadoutParser CBM readout parser
   /// \param essHeaderParser Header parser
   CbmInstrument(Statistics &Stats, Counters &counters, Config &Config,
                 Parser &cbmReadoutParser,
-                const HashMap2D<SchemaDetails> &SchemaDetailMap,
+                const DenseMap2D<SchemaDetails> &SchemaDetailMap,
                 ess_readout::Parser &essHeaderParser);
 
   /// \brief Process the beam monitor readouts.
@@ -61,7 +61,7 @@ private:
   Config &Conf;
 
   /// \brief References for the serializers of the supported types.
-  const HashMap2D<SchemaDetails> &SchemaMap;
+  const DenseMap2D<SchemaDetails> &SchemaMap;
 
   /// \brief Parser for the ESS Readout header.
   ess_readout::Parser &ESSHeaderParser;
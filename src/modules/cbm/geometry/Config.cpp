@@ -50,7 +50,7 @@ void Config::apply() {
   // Number of FENs must must be 1 even is MaxFENId is 0
   CbmParms.NumOfFENs = CbmParms.MaxFENId + 1;
 
-  TopologyMapPtr.reset(new HashMap2D<Topology>(CbmParms.NumOfFENs));
+  TopologyMapPtr.reset(new DenseMap2D<Topology>(CbmParms.NumOfFENs));
   if (not root().contains("Topology")) {
     throw std::runtime_error("No 'Topology' section found in the "
                              "configuration. Cannot setup Beam Monitors");
@@ -14,7 +14,7 @@
 #include <common/config/Config.h>
 #include <common/debug/Log.h>
 #include <common/debug/Trace.h>
-#include <common/memory/HashMap2D.h>
+#include <common/memory/DenseMap2D.h>
 #include <common/readout/ess/Parser.h>
 #include <modules/cbm/CbmTypes.h>
 #include <modules/cbm/SchemaType.h>
@@ -149,7 +149,7 @@ public:
 
   const DetectorType Instrument;
 
-  std::unique_ptr<HashMap2D<Topology>> TopologyMapPtr;
+  std::unique_ptr<DenseMap2D<Topology>> TopologyMapPtr;
 
 protected:
   /// \brief Exit with error message
@@ -35,7 +35,7 @@
 #include <modules/cbm/geometry/Config.h>
 #include <modules/cbm/readout/Parser.h>
 
-#include <unordered_map>
+#include <memory>
 
 // #undef TRC_LEVEL
 // #define TRC_LEVEL TRC_L_DEB
@@ -183,9 +183,7 @@ public:
   ///
   const CachedTopology *getCachedTopology(uint8_t FENId,
                                           uint8_t Channel) const {
-    uint16_t key = calcCacheKey(FENId, Channel);
-    auto it = TopologyCache.find(key);
-    return (it != TopologyCache.end()) ? &it->second : nullptr;
+    return TopologyCache.get(Channel, FENId);
   }
 
   ///
@@ -230,13 +228,6 @@ private:
     }
   }
 
-  ///
-  /// \brief Calculate cache key from FEN and Channel
-  ///
-  static inline uint16_t calcCacheKey(uint8_t FENId, uint8_t Channel) {
-    return (static_cast<uint16_t>(FENId) << 8) | Channel;
-  }
-
   ///
   /// \brief Initialize topology cache from configuration
   ///
@@ -247,17 +238,17 @@ private:
 
     std::vector<Topology *> topologies = Conf.TopologyMapPtr->toValuesList();
     for (const auto *item : topologies) {
-      uint16_t key = calcCacheKey(item->FEN, item->Channel);
+      std::unique_ptr<CachedTopology> Cached;
 
       if (item->Type == CbmType::EVENT_2D) {
-        TopologyCache.emplace(key,
-                              CachedTopology{item->Type, item->width,
-                                             item->height, item->pixelOffset});
+        Cached = std::make_unique<CachedTopology>(
+            item->Type, item->width, item->height, item->pixelOffset);
       } else if (item->Type == CbmType::EVENT_0D) {
-        TopologyCache.emplace(key, CachedTopology{item->pixelOffset});
+        Cached = std::make_unique<CachedTopology>(item->pixelOffset);
       } else { // IBM
-        TopologyCache.emplace(key, CachedTopology{});
+        Cached = std::make_unique<CachedTopology>();
       }
+      TopologyCache.add(item->Channel, item->FEN, Cached);
     }
   }
 
@@ -325,8 +316,8 @@ private:
   /// Configured monitor ring
   const uint8_t MonitorRing;
 
-  /// Topology cache: key = (FEN << 8) | Channel -> compact topology data
-  std::unordered_map<uint16_t, CachedTopology> TopologyCache;
+  /// Topology cache: (Channel, FEN) -> compact topology data
+  DenseMap2D<CachedTopology> TopologyCache{256};
 }; // namespace cbm
 
 } // namespace cbm
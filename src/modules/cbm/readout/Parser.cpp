@@ -26,6 +26,12 @@ void Parser::parse(ess_readout::Parser::PacketDataV0 &PacketData) {
   char *Buffer = (char *)PacketData.DataPtr;
   unsigned int Size = PacketData.DataLength;
 
+  // In place parsing refers to the packet data while all readouts are
+  // valid, from the first rejected readout the valid ones are copied
+  bool Copy = not ParseInPlace;
+  InPlaceReadouts = (const CbmReadout *)Buffer;
+  InPlaceCount = 0;
+
   if (Buffer == nullptr) {
     Stats.ErrorSize++;
     XTRACE(DATA, WAR, "Invalid data pointer");
@@ -46,7 +52,7 @@ void Parser::parse(ess_readout::Parser::PacketDataV0 &PacketData) {
   }
 
   Parser::CbmReadout *Readout = (struct CbmReadout *)Buffer;
-  for (unsigned int i = 0; i < Size / DataLength; i++) {
+  for (unsigned int i = 0; i < Size / DataLength; i++, Readout++) {
 
     Stats.Readouts++;
     if (Readout->FiberId > MaxFiberId) {
@@ -91,7 +97,16 @@ void Parser::parse(ess_readout::Parser::PacketDataV0 &PacketData) {
       continue;
     }
 
-    Result.push_back(*Readout);
+    if (not Copy and InPlaceCount < i) {
+      Result.assign(InPlaceReadouts, InPlaceReadouts + InPlaceCount);
+      Copy = true;
+    }
+
+    if (Copy) {
+      Result.push_back(*Readout);
+    } else {
+      InPlaceCount++;
+    }
 
     switch (Readout->Type) {
     case CbmType::EVENT_0D:
@@ -104,8 +119,6 @@ void Parser::parse(ess_readout::Parser::PacketDataV0 &PacketData) {
       Stats.ReadoutsIBM++;
       break;
     }
-
-    Readout++;
   }
 
   return;
@@ -11,6 +11,7 @@
 
 #include <cinttypes>
 #include <common/readout/ess/Parser.h>
+#include <common/readout/ess/ReadoutView.h>
 #include <cstdint>
 #include <vector>
 
@@ -103,6 +104,19 @@ public:
   ///
   void parse(ess_readout::Parser::PacketDataV0 &PacketData);
 
+  /// \brief don't copy readouts into Result, readouts() then refers to the
+  /// packet data, which must stay valid until the readouts are processed.
+  /// Packets with rejected readouts are still copied into Result.
+  void setInPlace(bool InPlace) { ParseInPlace = InPlace; }
+
+  /// \brief readouts of the last parse(), in place or in Result
+  ess_readout::ReadoutView<CbmReadout> readouts() const {
+    if (ParseInPlace and Result.empty()) {
+      return {InPlaceReadouts, InPlaceCount};
+    }
+    return {Result.data(), Result.size()};
+  }
+
 protected:
   ///
   /// \brief Validate the readout type
@@ -120,6 +134,10 @@ public:
   struct ParserStats Stats;
 
 private:
+  bool ParseInPlace{false};
+  const CbmReadout *InPlaceReadouts{nullptr};
+  size_t InPlaceCount{0};
+
   static constexpr uint16_t DataLength{
       static_cast<uint16_t>(sizeof(Parser::CbmReadout))};
   static constexpr unsigned int MaxUdpPayloadSize{
@@ -30,7 +30,7 @@ protected:
     CbmConfig.CbmParms.MaxFENId = 23;
 
     // Create topology configuration with multiple monitors of same type
-    CbmConfig.TopologyMapPtr = std::make_unique<HashMap2D<Topology>>(24);
+    CbmConfig.TopologyMapPtr = std::make_unique<DenseMap2D<Topology>>(24);
 
     // Add two EVENT_2D monitors at different FEN/Channel positions
     auto topo2D_1 = std::make_unique<Topology>(
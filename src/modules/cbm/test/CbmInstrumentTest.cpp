@@ -298,7 +298,7 @@ protected:
   std::unique_ptr<Statistics> Stats;
   std::unique_ptr<ess_readout::Parser> ESSHeaderParser;
   std::unique_ptr<cbm::Parser> CbmReadoutParser;
-  HashMap2D<SchemaDetails> SchemaMap{11};
+  DenseMap2D<SchemaDetails> SchemaMap{11};
   std::unique_ptr<CbmInstrument> cbm;
 
   inline static path FullConfigFile{""};
@@ -87,6 +87,31 @@ std::vector<uint8_t> DataGood {
   0x00, 0x00, 0x00, 0x00   // XPos 0, YPos 0
 };
 
+/// \brief Invalid readout between two valid readouts
+std::vector<uint8_t> DataBadMiddle {
+
+  // First readout
+  0x16, 0x00, 0x14, 0x00,  // Data header - Ring 22, FEN 0, Size 20
+  0x01, 0x00, 0x00, 0x00,  // Time HI 1 s
+  0x01, 0x00, 0x00, 0x00,  // Time LO 1 tick
+  0x01, 0x00, 0x00, 0x01,  // Type 0x01, Channel 0, ADC 0x100
+  0x00, 0x00, 0x00, 0x00,  // XPos 0, YPos 0
+
+  // Second readout
+  0x16, 0x00, 0x14, 0x00,  // Data header - Ring 22, FEN 0, Size 20
+  0x01, 0x00, 0x00, 0x00,  // Time HI 1 s
+  0x14, 0x93, 0x3f, 0x15,  // Time LO 88.052.500 not ok
+  0x01, 0x00, 0x00, 0x01,  // Type 0x01, Channel 0, ADC 0x100
+  0x00, 0x00, 0x00, 0x00,  // XPos 0, YPos 0
+
+  // Third readout
+  0x16, 0x00, 0x14, 0x00,  // Data header - Ring 22, FEN 0, Size 20
+  0x01, 0x00, 0x00, 0x00,  // Time HI 1 s
+  0x02, 0x00, 0x00, 0x00,  // Time LO 2 ticks
+  0x03, 0x00, 0x00, 0x01,  // Type 0x03, Channel 0, ADC 0x100
+  0x00, 0x00, 0x00, 0x00   // XPos 0, YPos 0
+};
+
 /// \brief Bad FEN value
 std::vector<uint8_t> BadFENData {
 
@@ -263,6 +288,51 @@ TEST_F(CbmParserTest, DataGood) {
   EXPECT_EQ(parser.Stats.ReadoutsIBM, 1);
 }
 
+TEST_F(CbmParserTest, ErrorDataTimeInPlace) {
+  makeHeader(DataBadFracTime);
+  parser.setInPlace(true);
+
+  parser.parse(PacketData);
+  EXPECT_EQ(parser.Result.size(), 0);
+  ASSERT_EQ(parser.readouts().size(), 1);
+  EXPECT_EQ((char *)&parser.readouts()[0], (char *)&DataBadFracTime[0]);
+  EXPECT_EQ(parser.readouts()[0].Type, 0x01); // EVENT_0D
+}
+
+TEST_F(CbmParserTest, ErrorDataTimeMiddle) {
+  makeHeader(DataBadMiddle);
+
+  parser.parse(PacketData);
+  EXPECT_EQ(parser.Stats.Readouts, 3);
+  EXPECT_EQ(parser.Stats.ErrorTimeFrac, 1);
+  EXPECT_EQ(parser.Stats.Readouts0D, 1);
+  EXPECT_EQ(parser.Stats.ReadoutsIBM, 1);
+  ASSERT_EQ(parser.readouts().size(), 2);
+  EXPECT_EQ(parser.readouts()[0].TimeLow, 1);
+  EXPECT_EQ(parser.readouts()[1].TimeLow, 2);
+}
+
+// the valid readouts are copied once a readout is rejected
+TEST_F(CbmParserTest, ErrorDataTimeMiddleInPlace) {
+  makeHeader(DataBadMiddle);
+  parser.setInPlace(true);
+
+  parser.parse(PacketData);
+  EXPECT_EQ(parser.Stats.ErrorTimeFrac, 1);
+  ASSERT_EQ(parser.readouts().size(), 2);
+  EXPECT_EQ(parser.readouts()[0].TimeLow, 1);
+  EXPECT_EQ(parser.readouts()[0].Type, 0x01); // EVENT_0D
+  EXPECT_EQ(parser.readouts()[1].TimeLow, 2);
+  EXPECT_EQ(parser.readouts()[1].Type, 0x03); // IBM
+
+  // a packet without rejected readouts is parsed in place again
+  makeHeader(DataGood);
+  parser.parse(PacketData);
+  EXPECT_EQ(parser.Result.size(), 0);
+  ASSERT_EQ(parser.readouts().size(), 2);
+  EXPECT_EQ((char *)&parser.readouts()[0], (char *)&DataGood[0]);
+}
+
 TEST_F(CbmParserTest, ErrorFENId) {
   makeHeader(BadFENData);
 
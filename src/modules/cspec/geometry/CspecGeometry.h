@@ -21,7 +21,7 @@
 // #define TRC_LEVEL TRC_L_DEB
 
 namespace caen {
-class CspecGeometry : public Geometry, ESSGeometry {
+class CspecGeometry final : public Geometry, ESSGeometry {
 public:
   // Detector geometry constants
   static constexpr int ESSGEOMETRY_NX{900}; ///< X dimension (pixels)
@@ -61,6 +61,9 @@ public:
   int Resolution;
 
 protected:
+  /// calcPixelStatic() calls calcPixelImpl() directly
+  friend class DetectorGeometry<DataParser::CaenReadout>;
+
   /// \brief Calculate pixel ID from readout data for CSPEC geometry
   /// \param Data Const reference to CaenReadout object
   /// \return Calculated pixel ID, or 0 if calculation failed
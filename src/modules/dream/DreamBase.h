@@ -62,8 +62,7 @@ DreamBase<Type_t>::DreamBase(BaseSettings const &Settings)
   Stats.create("produce.cause.timeout", Counters.ProduceCauseTimeout);
   // clang-format on
 
-  std::function<void()> inputFunc = [this]() { inputThread(); };
-  AddThreadFunction(inputFunc, "input");
+  addInputThreads();
 
   std::function<void()> processingFunc = [this]() {
     DreamBase::processingThread();
@@ -82,22 +81,24 @@ template <int Type_t> void DreamBase<Type_t>::processingThread() {
 
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
-
-  auto Produce = [&EventProducer](const auto &DataBuffer,
-                                  const auto &Timestamp) {
-    EventProducer.produce(DataBuffer, Timestamp);
-  };
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
 
   Serializer = std::make_unique<EV44Serializer>(
-      KafkaBufferSize, EFUSettings.DetectorName, Produce);
+      KafkaBufferSize, EFUSettings.DetectorName, EventProducer);
 
   Stats.create("produce.cause.pulse_change",
                Serializer->stats().ProduceRefTimeTriggered);
   Stats.create("produce.cause.max_events_reached",
                Serializer->stats().ProduceTriggeredMaxEvents);
+  Stats.create("produce.zero_copy", Serializer->stats().ProduceZeroCopy);
+  Stats.create("produce.copied", Serializer->stats().ProduceCopied);
 
   DreamInstrument<Type_t> Dream(Stats, Counters, EFUSettings, *Serializer,
                                 ESSHeaderParser);
+  // Readouts are processed before the ring buffer entry is reused
+  Dream.DreamParser.setInPlace(true);
 
   unsigned int DataIndex;
   Timer ProduceTimer;
@@ -109,8 +110,8 @@ template <int Type_t> void DreamBase<Type_t>::processingThread() {
 
     auto idle_start = local_clock::now();
 
-    if (InputFifo.pop(DataIndex)) { // There is data in the FIFO - do processing
-      auto DataLen = RxRingbuffer.getDataLength(DataIndex);
+    if (auto RxRing = popInput(DataIndex)) { // There is data - do processing
+      auto DataLen = RxRing->getDataLength(DataIndex);
       if (DataLen == 0) {
         ITCounters.FifoSeqErrors++;
         continue;
@@ -118,7 +119,7 @@ template <int Type_t> void DreamBase<Type_t>::processingThread() {
 
       /// \todo use the Buffer<T> class here and in parser?
       /// \todo avoid copying by passing reference to stats like for gdgem?
-      auto DataPtr = RxRingbuffer.getDataBuffer(DataIndex);
+      auto DataPtr = RxRing->getDataBuffer(DataIndex);
 
       auto Res = ESSHeaderParser.validate(DataPtr, DataLen, Type_t);
 
@@ -135,8 +136,8 @@ template <int Type_t> void DreamBase<Type_t>::processingThread() {
       // Process readouts, generate (end produce) events
       Dream.processReadouts();
 
-    } else { // There is NO data in the FIFO - do stop checks and sleep a little
-      usleep(100);
+    } else { // There is NO data in the FIFO - do stop checks and wait for data
+      waitForInput();
       Counters.ProcessingIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
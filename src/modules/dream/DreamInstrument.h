@@ -30,6 +30,7 @@
 #include <dream/geometry/Geometry.h>
 #include <dream/geometry/HeimdalGeometry.h>
 #include <dream/geometry/MagicGeometry.h>
+#include <dream/geometry/PixelLUT.h>
 
 #include <memory>
 
@@ -45,6 +46,7 @@ private:
   BaseSettings &Settings;
   Config DreamConfiguration;
   std::unique_ptr<Geometry> Geom;
+  std::unique_ptr<PixelLUT> PixelTable; ///< nullptr unless enabled in config
   EV44Serializer &Serializer;
   ess_readout::Parser &ESSHeaderParser;
 
@@ -93,16 +95,28 @@ DreamInstrument<Type_t>::DreamInstrument(Statistics &Stats, struct Counters &cou
      throw std::runtime_error("Configuration is incompatible with application. This EFU support DREAM");
     }
     Geom = std::make_unique<DreamGeometry>(Stats, DreamConfiguration);
+    if (DreamConfiguration.PixelLUT) {
+      PixelTable = std::make_unique<PixelLUT>(
+          PixelLUT::create<DreamGeometry>(DreamConfiguration));
+    }
   } else if (DreamConfiguration.Instance == Config::MAGIC) {
     if (Type_t != DetectorType::MAGIC) {
      throw std::runtime_error("Configuration is incompatible with application. This EFU support MAGIC");
     }
     Geom = std::make_unique<MagicGeometry>(Stats, DreamConfiguration);
+    if (DreamConfiguration.PixelLUT) {
+      PixelTable = std::make_unique<PixelLUT>(
+          PixelLUT::create<MagicGeometry>(DreamConfiguration));
+    }
   } else if (DreamConfiguration.Instance == Config::HEIMDAL) {
     if (Type_t != DetectorType::HEIMDAL) {
      throw std::runtime_error("Configuration is incompatible with application. This EFU support HEIMDAL");
     }
     Geom = std::make_unique<HeimdalGeometry>(Stats, DreamConfiguration);
+    if (DreamConfiguration.PixelLUT) {
+      PixelTable = std::make_unique<PixelLUT>(
+          PixelLUT::create<HeimdalGeometry>(DreamConfiguration));
+    }
   } else {
     throw std::runtime_error(
         "Unsupported instrument instance (not DREAM/MAGIC/HEIMDAL)");
@@ -116,7 +130,7 @@ void DreamInstrument<Type_t>::processReadouts() {
       ESSHeaderParser.Packet.Time.getRefTimeUInt64());
 
   /// Traverse readouts, calculate pixels
-  for (auto &Data : DreamParser.Result) {
+  for (auto &Data : DreamParser.readouts()) {
     XTRACE(DATA, DEB, "Ring %u, FEN %u", Data.FiberId / 2, Data.FENId);
 
     // Validate Ring, FEN and configuration through geometry class
@@ -132,9 +146,16 @@ void DreamInstrument<Type_t>::processReadouts() {
       continue;
     }  
 
-    // Calculate pixelid and apply calibration using polymorphism
+    // Calculate pixelid from the lookup table if enabled, otherwise (and for
+    // readouts not in the table) using polymorphism
     // The geometry extracts ModuleParms from the RMConfig array internally
-    uint32_t PixelId = Geom->calcPixel(Data);
+    uint32_t PixelId{0};
+    if (PixelTable) {
+      PixelId = PixelTable->lookup(Data);
+    }
+    if (PixelId == 0) {
+      PixelId = Geom->calcPixel(Data);
+    }
     XTRACE(DATA, DEB, "PixelId: %u", PixelId);
 
     if (PixelId != 0) {
@@ -47,6 +47,7 @@ void Config::apply() {
 
   setMask(LOG | XTRACE);
   assign("MaxPulseTimeDiffNS", MaxPulseTimeDiffNS);
+  assign("PixelLUT", PixelLUT);
 
   // Initialise all configured modules
   int Entry{0};
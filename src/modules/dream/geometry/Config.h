@@ -78,6 +78,10 @@ public:
 
   uint32_t MaxPulseTimeDiffNS{5 * 71'428'571}; // 5 * 1/14 * 10^9
 
+  /// Precalculate the pixels of all readouts (see PixelLUT), this uses
+  /// 256 KiB per configured Ring/FEN and UnitId
+  bool PixelLUT{false};
+
   ModuleParms RMConfig[MaxRing + 1][MaxFEN + 1];
 
   DetectorInstance Instance{NONE};
@@ -39,6 +39,11 @@ uint32_t MagicGeometry::calcPixelImpl(const DataParser::CDTReadout &Data) const
     break;
   }
 
+  if (Pixel == 0) {
+    XTRACE(DATA, WAR, "Invalid pixel returned in module: %i", Parms.Type);
+    return 0;
+  }
+
   int Offset = getPixelOffset(Parms.Type);
   if (Offset == -1) {
     return 0;
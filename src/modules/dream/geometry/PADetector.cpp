@@ -17,8 +17,14 @@ uint32_t PADetector::calcPixelId(const Config::ModuleParms &Parms,
   XTRACE(EVENT, DEB, "Sector %u, Cassette %u, Counter %u, Wire %u, Strip %u",
          Sector, Cassette, Counter, Wire, Strip);
 
-  uint16_t X = getX(Sector, Cassette, Counter);
-  uint16_t Y = getY(Wire, Strip);
+  int IntX = getX(Sector, Cassette, Counter);
+  int IntY = getY(Wire, Strip);
+  if (IntX < 0 || IntY < 0) {
+    // PixelId 0 is invalid
+    return 0;
+  }
+  uint16_t X = static_cast<uint16_t>(IntX);
+  uint16_t Y = static_cast<uint16_t>(IntY);
   uint32_t Pixel = pixel2D(X, Y);
 
   XTRACE(EVENT, DEB, "x %u, y %u - pixel: %u", X, Y, Pixel);
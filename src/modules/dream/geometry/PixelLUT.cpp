@@ -0,0 +1,85 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Precalculated pixel ids for DREAM, MAGIC and HEIMDAL readouts
+//===----------------------------------------------------------------------===//
+
+#include <common/debug/Trace.h>
+#include <dream/geometry/PixelLUT.h>
+
+// #undef TRC_LEVEL
+// #define TRC_LEVEL TRC_L_DEB
+
+namespace dream {
+
+PixelLUT::PixelLUT(const Config &Config, const Geometry &Geom) {
+  // Table layout
+  size_t Entries{0};
+  for (int Ring = 0; Ring < Rings; Ring++) {
+    for (int FEN = 0; FEN < FENs; FEN++) {
+      const Config::ModuleParms &Parms = Config.RMConfig[Ring][FEN];
+      if (not Parms.Initialised) {
+        continue;
+      }
+      Slot &Entry = Slots[Ring][FEN];
+      unitRange(Parms.Type, Entry.FirstUnit, Entry.Units);
+      Entry.UnitMask = Entry.Units > 1 ? 0xFF : 0x00;
+      Entry.Offset = Entries;
+      Entries += Entry.Units << 16;
+    }
+  }
+  Pixels.resize(Entries);
+
+  // Fill the table using the geometry
+  DataParser::CDTReadout Data{};
+  for (int Ring = 0; Ring < Rings; Ring++) {
+    for (int FEN = 0; FEN < FENs; FEN++) {
+      const Slot &Entry = Slots[Ring][FEN];
+      Data.FiberId = Ring * 2;
+      Data.FENId = FEN;
+      for (unsigned Unit = 0; Unit < Entry.Units; Unit++) {
+        Data.UnitId = Entry.FirstUnit + Unit;
+        for (unsigned Cathode = 0; Cathode < 256; Cathode++) {
+          Data.Cathode = Cathode;
+          uint32_t *Row =
+              &Pixels[Entry.Offset + (Unit << 16) + (Cathode << 8)];
+          fillRow(Geom, Data, Row);
+        }
+      }
+    }
+  }
+  XTRACE(INIT, ALW, "Pixel lookup table with %zu entries", Entries);
+}
+
+void PixelLUT::fillRow(const Geometry &Geom, DataParser::CDTReadout &Data,
+                       uint32_t *Row) {
+  // invalid readouts get pixel 0 and are left to the geometry
+  for (unsigned Anode = 0; Anode < 256; Anode++) {
+    Data.Anode = Anode;
+    Row[Anode] = Geom.calcPixel(Data);
+  }
+}
+
+void PixelLUT::unitRange(Config::ModuleType Type, uint8_t &FirstUnit,
+                         uint8_t &Units) {
+  switch (Type) {
+  case Config::BwEndCap:
+  case Config::FwEndCap:
+    FirstUnit = 3; // SUMO 3 - 6
+    Units = 4;
+    break;
+  case Config::HR:
+  case Config::SANS:
+    FirstUnit = 0; // Cuboid index P1 or P2
+    Units = 2;
+    break;
+  default:
+    FirstUnit = 0; // UnitId is not used
+    Units = 1;
+    break;
+  }
+}
+
+} // namespace dream
@@ -0,0 +1,96 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Precalculated pixel ids for DREAM, MAGIC and HEIMDAL readouts
+///
+/// The pixel of a CDT readout only depends on Ring, FEN, UnitId, Cathode and
+/// Anode. For each configured Ring/FEN the pixels of all UnitId (those used
+/// by the module type), Cathode and Anode combinations are calculated once
+/// with the geometry, so pixel calculation becomes a table lookup. Readouts
+/// for which the geometry returns the invalid pixel 0 are stored as 0, these
+/// are still handled by the geometry so that the error counters are
+/// unchanged. This relies on the geometry returning 0 for every readout it
+/// counts as an error.
+///
+/// Memory: each configured Ring/FEN gets 256 x 256 entries (Cathode, Anode)
+/// of 4 bytes, 256 KiB, per UnitId used by its module type. That is one
+/// table for most module types, two for HR and SANS cuboids and four for
+/// the endcap SUMOs (1 MiB).
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <common/Statistics.h>
+#include <dream/geometry/Config.h>
+#include <dream/geometry/Geometry.h>
+#include <dream/readout/DataParser.h>
+#include <cstdint>
+#include <vector>
+
+namespace dream {
+
+class PixelLUT {
+public:
+  /// \brief calculate the table using a private instance of the geometry,
+  /// so that the counters of the instrument geometry are not incremented
+  /// \param Config The loaded configuration
+  template <typename GeometryType>
+  static PixelLUT create(const Config &Config) {
+    Statistics GeometryStats;
+    GeometryType Geom(GeometryStats, Config);
+    return PixelLUT(Config, Geom);
+  }
+
+  /// \brief calculate the table
+  /// \param Config The loaded configuration
+  /// \param Geom Geometry used for the calculation
+  PixelLUT(const Config &Config, const Geometry &Geom);
+
+  /// \brief pixel id of a readout
+  /// \return the pixel id, or 0 if the readout must be handled by the
+  /// geometry
+  inline uint32_t lookup(const DataParser::CDTReadout &Data) const {
+    int Ring = Data.FiberId / 2;
+    if (Ring >= Rings or Data.FENId >= FENs) {
+      return 0;
+    }
+    const Slot &Entry = Slots[Ring][Data.FENId];
+    uint8_t Unit = uint8_t(Data.UnitId - Entry.FirstUnit) & Entry.UnitMask;
+    if (Unit >= Entry.Units) {
+      return 0;
+    }
+    return Pixels[Entry.Offset + (Unit << 16) + (Data.Cathode << 8) +
+                  Data.Anode];
+  }
+
+  /// \brief size of the table in bytes
+  size_t bytes() const { return Pixels.size() * sizeof(uint32_t); }
+
+private:
+  static constexpr int Rings{Config::MaxRing + 1};
+  static constexpr int FENs{Config::MaxFEN + 1};
+
+  /// \brief Table layout for one Ring/FEN
+  struct Slot {
+    uint32_t Offset{0};   ///< index of the first entry in Pixels
+    uint8_t FirstUnit{0}; ///< UnitId of the first table
+    uint8_t UnitMask{0};  ///< 0 when the module type ignores UnitId
+    uint8_t Units{0};     ///< number of tables, 0 if not configured
+  };
+
+  /// \brief UnitId values that are used by a module type, Units is 1 for
+  /// module types that ignore UnitId
+  static void unitRange(Config::ModuleType Type, uint8_t &FirstUnit,
+                        uint8_t &Units);
+
+  /// \brief calculate the pixels for all Anodes, Data has the other fields
+  static void fillRow(const Geometry &Geom, DataParser::CDTReadout &Data,
+                      uint32_t *Row);
+
+  Slot Slots[Rings][FENs];
+  std::vector<uint32_t> Pixels;
+};
+
+} // namespace dream
@@ -20,6 +20,9 @@ constexpr unsigned int CDTReadoutSize{sizeof(DataParser::CDTReadout)};
 // Assume we start after the PacketHeader
 int DataParser::parse(const char *Buffer, unsigned int Size) {
   Result.clear();
+  // Parsing stops at the first error, so the valid readouts are consecutive
+  InPlaceReadouts = (const CDTReadout *)Buffer;
+  InPlaceCount = 0;
   unsigned int ParsedReadouts = 0;
 
   unsigned int BytesLeft = Size;
@@ -74,7 +77,11 @@ int DataParser::parse(const char *Buffer, unsigned int Size) {
     ParsedReadouts++;
     Stats.Readouts++;
 
-    Result.push_back(*Data);
+    if (ParseInPlace) {
+      InPlaceCount++;
+    } else {
+      Result.push_back(*Data);
+    }
     BytesLeft -= Data->DataLength;
     DataPtr += Data->DataLength;
   }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <common/readout/ess/Parser.h>
+#include <common/readout/ess/ReadoutView.h>
 #include <modules/dream/Counters.h>
 #include <vector>
 
@@ -43,9 +44,26 @@ public:
   //
   int parse(const char *buffer, unsigned int size);
 
+  /// \brief don't copy readouts into Result, readouts() then refers to the
+  /// parsed buffer, which must stay valid until the readouts are processed
+  void setInPlace(bool InPlace) { ParseInPlace = InPlace; }
+
+  /// \brief readouts of the last parse(), in place or in Result
+  ess_readout::ReadoutView<CDTReadout> readouts() const {
+    if (ParseInPlace) {
+      return {InPlaceReadouts, InPlaceCount};
+    }
+    return {Result.data(), Result.size()};
+  }
+
   // To be iterated over in processing thread
   std::vector<struct CDTReadout> Result;
 
   struct Counters &Stats;
+
+private:
+  bool ParseInPlace{false};
+  const CDTReadout *InPlaceReadouts{nullptr};
+  size_t InPlaceCount{0};
 };
 } // namespace dream
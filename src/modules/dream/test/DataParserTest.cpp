@@ -91,6 +91,15 @@ TEST_F(DataParserTest, ParseThree) {
   ASSERT_EQ(Parser.Result.size(), 3);
 }
 
+TEST_F(DataParserTest, ReadoutSizeErrorOnSecondInPlace) {
+  Parser.setInPlace(true);
+  auto Res = Parser.parse((char *)&ErrReadoutSize[0], ErrReadoutSize.size());
+  ASSERT_EQ(Res, 1);
+  ASSERT_EQ(Parser.Result.size(), 0);
+  ASSERT_EQ(Parser.readouts().size(), 1);
+  EXPECT_EQ((char *)&Parser.readouts()[0], (char *)&ErrReadoutSize[0]);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,100 @@
+// Copyright (C) 2026 European Spallation Source ERIC
+
+/// \file
+/// \brief Pixel calculation by the DREAM geometry versus the pixel lookup
+/// table
+///
+/// Readouts are random valid Cathode and Anode values for a mix of the
+/// DREAM module types.
+
+#include <benchmark/benchmark.h>
+#include <common/Statistics.h>
+#include <dream/geometry/Config.h>
+#include <dream/geometry/DreamGeometry.h>
+#include <dream/geometry/PixelLUT.h>
+#include <random>
+#include <vector>
+
+using namespace dream;
+
+static constexpr size_t Readouts{10000};
+
+struct DreamSetup {
+  Config DreamConfig;
+  std::vector<DataParser::CDTReadout> Data;
+
+  DreamSetup() {
+    addModule(0, 0, Config::BwEndCap, 3, 0, 6);
+    addModule(0, 1, Config::FwEndCap, 5, 0, 4);
+    addModule(1, 0, Config::DreamMantle, 2, 3, 0);
+    addModule(2, 0, Config::HR, 4, 5, 1);
+    addModule(2, 1, Config::SANS, 10, 11, 0);
+
+    std::mt19937 Random(42);
+    std::uniform_int_distribution<uint32_t> Module(0, Modules.size() - 1);
+    std::uniform_int_distribution<uint32_t> Value(0, 255);
+    Statistics Stats;
+    DreamGeometry Geom(Stats, DreamConfig);
+    while (Data.size() < Readouts) {
+      DataParser::CDTReadout Readout = Modules[Module(Random)];
+      Readout.Cathode = Value(Random);
+      Readout.Anode = Value(Random);
+      if (Geom.calcPixel(Readout) != 0) {
+        Data.push_back(Readout);
+      }
+    }
+  }
+
+private:
+  std::vector<DataParser::CDTReadout> Modules;
+
+  void addModule(int Ring, int FEN, Config::ModuleType Type, int P1, int P2,
+                 uint8_t UnitId) {
+    Config::ModuleParms &Parms = DreamConfig.RMConfig[Ring][FEN];
+    Parms.Initialised = true;
+    Parms.Type = Type;
+    Parms.P1.Index = P1;
+    Parms.P2.Index = P2;
+
+    DataParser::CDTReadout Readout{};
+    Readout.FiberId = 2 * Ring;
+    Readout.FENId = FEN;
+    Readout.UnitId = UnitId;
+    Modules.push_back(Readout);
+  }
+};
+
+static void GeometryPixels(benchmark::State &state) {
+  DreamSetup Setup;
+  Statistics Stats;
+  DreamGeometry Geom(Stats, Setup.DreamConfig);
+
+  for (auto _ : state) {
+    for (auto &Readout : Setup.Data) {
+      benchmark::DoNotOptimize(Geom.calcPixel(Readout));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(GeometryPixels);
+
+static void LookupPixels(benchmark::State &state) {
+  DreamSetup Setup;
+  Statistics Stats;
+  DreamGeometry Geom(Stats, Setup.DreamConfig);
+  PixelLUT LUT = PixelLUT::create<DreamGeometry>(Setup.DreamConfig);
+
+  for (auto _ : state) {
+    for (auto &Readout : Setup.Data) {
+      uint32_t Pixel = LUT.lookup(Readout);
+      if (Pixel == 0) {
+        Pixel = Geom.calcPixel(Readout);
+      }
+      benchmark::DoNotOptimize(Pixel);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * Readouts);
+}
+BENCHMARK(LookupPixels);
+
+BENCHMARK_MAIN();
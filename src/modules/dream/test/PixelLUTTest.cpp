@@ -0,0 +1,124 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Unit test comparing the pixel lookup table with the geometries
+//===----------------------------------------------------------------------===//
+
+#include <common/Statistics.h>
+#include <common/testutils/TestBase.h>
+#include <dream/geometry/Config.h>
+#include <dream/geometry/DreamGeometry.h>
+#include <dream/geometry/HeimdalGeometry.h>
+#include <dream/geometry/MagicGeometry.h>
+#include <dream/geometry/PixelLUT.h>
+#include <dream/readout/DataParser.h>
+
+using namespace dream;
+
+class PixelLUTTest : public TestBase {
+protected:
+  Config DreamConfig;
+
+  void addModule(int Ring, int FEN, Config::ModuleType Type, int P1, int P2) {
+    Config::ModuleParms &Parms = DreamConfig.RMConfig[Ring][FEN];
+    Parms.Initialised = true;
+    Parms.Type = Type;
+    Parms.P1.Index = P1;
+    Parms.P2.Index = P2;
+  }
+
+  /// \brief compare table lookup (with geometry fallback) against the
+  /// geometry for all Cathode and Anode values of the configured modules,
+  /// including the resulting counters. UnitIds above 7 are never in the
+  /// table, so only some of them are checked to keep the test fast
+  template <typename GeometryType> void compareAll() {
+    Statistics Stats;
+    Statistics LUTStats;
+    GeometryType Geom(Stats, DreamConfig);
+    GeometryType LUTGeom(LUTStats, DreamConfig);
+    PixelLUT LUT = PixelLUT::create<GeometryType>(DreamConfig);
+
+    DataParser::CDTReadout Data{};
+    size_t Pixels{0};
+    size_t Mismatches{0};
+    for (int Ring = 0; Ring <= Config::MaxRing; Ring++) {
+      for (int FEN = 0; FEN <= Config::MaxFEN; FEN++) {
+        if (not DreamConfig.RMConfig[Ring][FEN].Initialised) {
+          continue;
+        }
+        Data.FiberId = 2 * Ring;
+        Data.FENId = FEN;
+        for (int Unit : {0, 1, 2, 3, 4, 5, 6, 7, 8, 128, 255}) {
+          Data.UnitId = Unit;
+          for (int Index = 0; Index < (1 << 16); Index++) {
+            Data.Cathode = Index >> 8;
+            Data.Anode = Index & 0xFF;
+            uint32_t Pixel = LUT.lookup(Data);
+            if (Pixel == 0) {
+              Pixel = LUTGeom.calcPixel(Data);
+            }
+            Mismatches += (Pixel != Geom.calcPixel(Data));
+            Pixels += (Pixel != 0);
+          }
+        }
+      }
+    }
+    ASSERT_EQ(Mismatches, 0);
+    ASSERT_NE(Pixels, 0);
+
+    ASSERT_EQ(Stats.size(), LUTStats.size());
+    for (size_t Index = 1; Index <= Stats.size(); Index++) {
+      ASSERT_EQ(Stats.getValue(Index), LUTStats.getValue(Index))
+          << Stats.getStatName(Index);
+    }
+  }
+};
+
+TEST_F(PixelLUTTest, Dream) {
+  addModule(0, 0, Config::BwEndCap, 3, 0);
+  addModule(0, 1, Config::FwEndCap, 22, 0);
+  addModule(1, 0, Config::DreamMantle, 2, 3);
+  addModule(2, 0, Config::HR, 4, 5);
+  addModule(2, 1, Config::SANS, 33, 40); // 40 is an invalid index
+  addModule(11, 11, Config::HR, 0, 32);
+  compareAll<DreamGeometry>();
+}
+
+TEST_F(PixelLUTTest, Magic) {
+  addModule(0, 0, Config::PA, 2, 0);
+  addModule(0, 1, Config::PA, 9, 0); // invalid sector
+  addModule(1, 0, Config::FR, 1, 2);
+  compareAll<MagicGeometry>();
+}
+
+TEST_F(PixelLUTTest, Heimdal) {
+  addModule(0, 0, Config::HeimdalMantle, 0, 0);
+  addModule(5, 7, Config::HeimdalMantle, 11, 5);
+  compareAll<HeimdalGeometry>();
+}
+
+TEST_F(PixelLUTTest, NotConfigured) {
+  addModule(0, 0, Config::DreamMantle, 2, 3);
+  PixelLUT LUT = PixelLUT::create<DreamGeometry>(DreamConfig);
+  ASSERT_EQ(LUT.bytes(), 256 * 256 * sizeof(uint32_t));
+
+  DataParser::CDTReadout Data{};
+  Data.Anode = 1;
+  Data.Cathode = 1;
+  ASSERT_NE(LUT.lookup(Data), 0);
+
+  Data.FENId = 1;
+  ASSERT_EQ(LUT.lookup(Data), 0);
+  Data.FENId = 200;
+  ASSERT_EQ(LUT.lookup(Data), 0);
+  Data.FENId = 0;
+  Data.FiberId = 200;
+  ASSERT_EQ(LUT.lookup(Data), 0);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
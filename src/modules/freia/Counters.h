@@ -12,6 +12,7 @@
 #include <common/kafka/Producer.h>
 #include <common/readout/ess/Parser.h>
 #include <common/readout/vmm3/VMM3Parser.h>
+#include <common/reduction/EventBuilder2DFlusher.h>
 #include <common/reduction/matching/GapMatcher.h>
 
 struct Counters {
@@ -36,6 +37,7 @@ struct Counters {
   int64_t EventsInvalidStripGap;
   int64_t EventsInvalidWireGap;
   struct GapMatcherStats MatcherStats;
+  struct EventBuilder2DFlusherStats FlushStats;
 
   // Identification of the cause of produce calls
   int64_t ProduceCauseTimeout;
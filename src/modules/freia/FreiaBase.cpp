@@ -58,6 +58,10 @@ FreiaBase::FreiaBase(BaseSettings const &settings) : Detector(settings) {
   Stats.create("cluster.no_coincidence", Counters.EventsNoCoincidence);
   Stats.create("cluster.wire_only", Counters.EventsMatchedWireOnly);
   Stats.create("cluster.strip_only", Counters.EventsMatchedStripOnly);
+  Stats.create("cluster.builders.flushes", Counters.FlushStats.Flushes);
+  Stats.create("cluster.builders.flushed", Counters.FlushStats.BuildersFlushed);
+  Stats.create("cluster.builders.flushed_last", Counters.FlushStats.LastBuildersFlushed);
+  Stats.create("cluster.builders.deferred_full_flushes", Counters.FlushStats.DeferredFullFlushes);
 
   // Event stats
   Stats.create("events.count", Counters.Events);
@@ -86,8 +90,7 @@ FreiaBase::FreiaBase(BaseSettings const &settings) : Detector(settings) {
   Stats.create("memory.cluster_storage.malloc_fallback_count", ClusterPoolStorage::Pool->Stats.MallocFallbackCount);
   // clang-format on
 
-  std::function<void()> inputFunc = [this]() { inputThread(); };
-  AddThreadFunction(inputFunc, "input");
+  addInputThreads();
 
   std::function<void()> processingFunc = [this]() {
     FreiaBase::processing_thread();
@@ -106,18 +109,18 @@ void FreiaBase::processing_thread() {
   KafkaConfig KafkaCfg(EFUSettings.KafkaConfigFile);
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
-  auto Produce = [&EventProducer](const auto &DataBuffer,
-                                  const auto &Timestamp) {
-    EventProducer.produce(DataBuffer, Timestamp);
-  };
-
-  Serializer = std::make_unique<EV44Serializer>(KafkaBufferSize,
-                                                FlatBufferSource, Produce);
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
+  Serializer = std::make_unique<EV44Serializer>(
+      KafkaBufferSize, FlatBufferSource, EventProducer);
 
   Stats.create("produce.cause.pulse_change",
                Serializer->stats().ProduceRefTimeTriggered);
   Stats.create("produce.cause.max_events_reached",
                Serializer->stats().ProduceTriggeredMaxEvents);
+  Stats.create("produce.zero_copy", Serializer->stats().ProduceZeroCopy);
+  Stats.create("produce.copied", Serializer->stats().ProduceCopied);
 
   // Convert string to DetectorType (will throw if invalid)
   DetectorType detectorType(EFUSettings.DetectorName);
@@ -143,6 +146,8 @@ void FreiaBase::processing_thread() {
 
   FreiaInstrument Freia(Counters, EFUSettings, *Serializer, ESSHeaderParser,
                         Stats, detectorType);
+  // Readouts are processed before the ring buffer entry is reused
+  Freia.VMMParser.setInPlace(true);
 
   unsigned int DataIndex;
 
@@ -157,15 +162,15 @@ void FreiaBase::processing_thread() {
 
     auto idle_start = local_clock::now();
 
-    if (InputFifo.pop(DataIndex)) { // There is data in the FIFO - do processing
-      auto DataLen = RxRingbuffer.getDataLength(DataIndex);
+    if (auto RxRing = popInput(DataIndex)) { // There is data - do processing
+      auto DataLen = RxRing->getDataLength(DataIndex);
       if (DataLen == 0) {
         ITCounters.FifoSeqErrors++;
         continue;
       }
 
       /// \todo use the Buffer<T> class here and in parser
-      auto DataPtr = RxRingbuffer.getDataBuffer(DataIndex);
+      auto DataPtr = RxRing->getDataBuffer(DataIndex);
 
       auto Res = ESSHeaderParser.validate(DataPtr, DataLen, detectorType);
 
@@ -182,17 +187,19 @@ void FreiaBase::processing_thread() {
       Counters.VMMStats = Freia.VMMParser.Stats;
 
       Freia.processReadouts();
+      Counters.FlushStats = Freia.Flusher.Stats;
 
-      for (auto &builder : Freia.builders) {
+      for (auto Index : Freia.Flusher.flushed()) {
+        auto &builder = Freia.builders[Index];
         Freia.generateEvents(builder.Events);
         Counters.MatcherStats.addAndClear(builder.matcher.Stats);
       }
       // done processing data
 
     } else {
-      // There is NO data in the FIFO - increment idle counter and sleep a
-      // little
-      usleep(100);
+      // There is NO data in the FIFO - increment idle counter and wait
+      // for data
+      waitForInput();
       Counters.ProcessingIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
@@ -200,6 +207,18 @@ void FreiaBase::processing_thread() {
 
       // Poll Kafka to handle events and delivery reports
       EventProducer.poll(0);
+
+      // Builders waiting for their flush delay are fully flushed also
+      // when no more packets arrive
+      if (Freia.Flusher.pending()) {
+        Freia.Flusher.flush(Freia.builders, true);
+        Counters.FlushStats = Freia.Flusher.Stats;
+        for (auto Index : Freia.Flusher.flushed()) {
+          auto &builder = Freia.builders[Index];
+          Freia.generateEvents(builder.Events);
+          Counters.MatcherStats.addAndClear(builder.matcher.Stats);
+        }
+      }
     }
 
     if (ProduceTimer.timeout()) {
@@ -67,6 +67,8 @@ void FreiaInstrument::loadConfigAndCalib() {
           Conf.MBFileParms.SplitMultiEventsCoefficientHigh);
     }
   }
+  Flusher = EventBuilder2DFlusher(
+      builders.size(), Conf.MBFileParms.BuilderFlushDelayUs * 1000ULL);
 
   if (Settings.CalibFile != "") {
     XTRACE(INIT, ALW, "Loading and applying calibration file");
@@ -81,7 +83,7 @@ void FreiaInstrument::processReadouts() {
   Serializer.checkAndSetReferenceTime(
       ESSHeaderParser.Packet.Time.getRefTimeUInt64());
 
-  for (const auto &readout : VMMParser.Result) {
+  for (const auto &readout : VMMParser.readouts()) {
     XTRACE(DATA, INF,
            "readout: FiberId %d, FENId %d, VMM %d, Channel %d, TimeLow %d",
            readout.FiberId, readout.FENId, readout.VMM, readout.Channel,
@@ -145,11 +147,10 @@ void FreiaInstrument::processReadouts() {
     // Insert into appropriate builder based on plane
     uint8_t plane = result.isXPlane ? PlaneX : PlaneY;
     builders[Hybrid.HybridNumber].insert({TimeNS, result.coord, ADC, plane});
+    Flusher.touch(Hybrid.HybridNumber);
   }
 
-  for (auto &builder : builders) {
-    builder.flush(true);
-  }
+  Flusher.flush(builders, true);
 }
 
 void FreiaInstrument::generateEvents(std::vector<Event> &Events) {
@@ -15,6 +15,7 @@
 #include <common/readout/vmm3/Readout.h>
 #include <common/readout/vmm3/VMM3Parser.h>
 #include <common/reduction/EventBuilder2D.h>
+#include <common/reduction/EventBuilder2DFlusher.h>
 #include <common/types/DetectorType.h>
 #include <common/geometry/vmm3/VMM3Geometry.h>
 #include <freia/geometry/AmorGeometry.h>
@@ -128,6 +129,9 @@ public:
   /// parsed the configuration file and know the number of cassettes
   std::vector<EventBuilder2D> builders; // reinit in ctor
 
+  /// \brief flushes the builders which received hits, reinit in ctor
+  EventBuilder2DFlusher Flusher;
+
   /// \brief parser for VMM3 readout data
   vmm3::VMM3Parser VMMParser;
 };
@@ -39,6 +39,7 @@ void Config::applyConfig() {
   assign("SplitMultiEventsCoefficientHigh", MBFileParms.SplitMultiEventsCoefficientHigh);
   assign("MaxMatchingTimeGap", MBFileParms.MaxMatchingTimeGap);
   assign("MaxClusteringTimeGap", MBFileParms.MaxClusteringTimeGap);
+  assign("BuilderFlushDelayUs", MBFileParms.BuilderFlushDelayUs);
 
   /// RING/FEN/Hybrid
   auto PanelConfig = root()["Config"];
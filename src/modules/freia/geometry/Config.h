@@ -49,6 +49,7 @@ public:
     float SplitMultiEventsCoefficientHigh{1.2};
     uint16_t MaxMatchingTimeGap{500};
     uint16_t MaxClusteringTimeGap{500};
+    uint32_t BuilderFlushDelayUs{0}; ///< 0 - full flush every packet
   } MBFileParms;
 };
 
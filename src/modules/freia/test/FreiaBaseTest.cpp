@@ -15,6 +15,31 @@
 #include <vector>
 
 // clang-format off
+std::vector<uint8_t> TestPacket{
+              0x00, 0x00, // pad, v0
+  0x45, 0x53, 0x53, 0x48, // 'E', 'S', 'S', type 0x48
+  0x46, 0x00, 0x0B, 0x00, // len(0x005e), OQ11, TSrc0
+  0x00, 0x00, 0x00, 0x00, // PT HI
+  0x00, 0x00, 0x00, 0x00, // PT LO
+  0x00, 0x00, 0x00, 0x00, // PPT HI
+  0x00, 0x00, 0x00, 0x00, // PPT Lo
+  0x08, 0x00, 0x00, 0x00, // Seq number 8
+
+  // First readout - Ring 0, FEN 1, cassette 2
+  0x01, 0x01, 0x14, 0x00, // Data Header
+  0x01, 0x00, 0x00, 0x00, // Time HI 1 s
+  0x01, 0x00, 0x00, 0x00, // Time LO 1 tick
+  0x00, 0x00, 0x00, 0x01, // ADC 0x100
+  0x00, 0x00, 0x00, 0x10, // GEO 0, TDC 0, VMM 0, CH 16
+
+  // Second readout - Ring 1, FEN 0, cassette 4
+  0x02, 0x00, 0x14, 0x00, // Data Header
+  0x01, 0x00, 0x00, 0x00, // Time HI 1 s
+  0x01, 0x00, 0x00, 0x00, // Time LO 1 tick
+  0x00, 0x00, 0x00, 0x01, // ADC 0x100
+  0x00, 0x00, 0x00, 0x10, // GEO 0, TDC 0, VMM 0, CH 16
+};
+
 std::vector<uint8_t> BadTestPacket{
               0x00, 0x00, // pad, v0
   0x45, 0x53, 0x53, 0x48, // 'E', 'S', 'S', type 0x48
@@ -69,14 +94,16 @@ TEST_F(FreiaBaseTest, Constructor) {
 TEST_F(FreiaBaseTest, DataReceive) {
   freia::FreiaBase Readout(Settings);
 
-  writePacketToRxFIFO(Readout, BadTestPacket);
+  writePacketToRxFIFO(Readout, TestPacket);
 
   // number of readouts in TestPacket
   EXPECT_EQ(Readout.Counters.VMMStats.Readouts, 2);
   EXPECT_EQ(Readout.Counters.VMMStats.DataReadouts, 2);
-  // Freia has 32 cassettes, and 32 event builders, so match attempt
-  // count increases by 32 for each packet received
-  EXPECT_EQ(Readout.Counters.MatcherStats.MatchAttemptCount, 32);
+  // Freia has 32 cassettes and 32 event builders, but only the builders
+  // of the two cassettes which received hits attempt matching
+  EXPECT_EQ(Readout.Counters.FlushStats.Flushes, 1);
+  EXPECT_EQ(Readout.Counters.FlushStats.BuildersFlushed, 2);
+  EXPECT_EQ(Readout.Counters.MatcherStats.MatchAttemptCount, 2);
   Readout.stopThreads();
 }
 
@@ -27,7 +27,7 @@
 
 namespace caen {
 
-class LokiGeometry : public Geometry, ESSGeometry {
+class LokiGeometry final : public Geometry, ESSGeometry {
 public:
   explicit LokiGeometry(Statistics &Stats, Config &CaenConfiguration);
 
@@ -77,6 +77,9 @@ public:
   }
 
 protected:
+  /// calcPixelStatic() calls calcPixelImpl() directly
+  friend class DetectorGeometry<DataParser::CaenReadout>;
+
   /// \brief Implementation for pixel calculation for Loki geometry
   /// \param Data Const reference to CaenReadout object
   /// \return Calculated pixel ID, or 0 if calculation failed
@@ -22,7 +22,7 @@
 // #define TRC_LEVEL TRC_L_DEB
 
 namespace caen {
-class MiraclesGeometry : public Geometry, ESSGeometry {
+class MiraclesGeometry final : public Geometry, ESSGeometry {
 public:
   explicit MiraclesGeometry(Statistics &Stats, const Config &CaenConfiguration,
                             int MaxAmpl = std::numeric_limits<int>::max());
@@ -70,6 +70,9 @@ public:
   }
 
 protected:
+  /// calcPixelStatic() calls calcPixelImpl() directly
+  friend class DetectorGeometry<DataParser::CaenReadout>;
+
   /// \brief Calculate pixel ID from readout data
   /// \param Data Const reference to CaenReadout object
   /// \return Calculated pixel ID, or 0 if calculation failed
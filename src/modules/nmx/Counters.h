@@ -11,6 +11,7 @@
 
 #include <common/readout/ess/Parser.h>
 #include <common/readout/vmm3/VMM3Parser.h>
+#include <common/reduction/EventBuilder2DFlusher.h>
 #include <common/reduction/matching/GapMatcher.h>
 
 #include <cinttypes>
@@ -29,6 +30,7 @@ struct Counters {
   int64_t MappingErrors;
 
   struct GapMatcherStats MatcherStats;
+  struct EventBuilder2DFlusherStats FlushStats;
   //
   int64_t ProcessingIdle;
   int64_t Events;
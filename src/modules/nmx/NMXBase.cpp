@@ -64,6 +64,10 @@ NmxBase::NmxBase(BaseSettings const &settings) : Detector(settings) {
   Stats.create("cluster.matcherstats.discared_span_too_large", Counters.MatcherStats.DiscardedSpanTooLarge);
   Stats.create("cluster.matcherstats.split_span_too_large", Counters.MatcherStats.SplitSpanTooLarge);
   Stats.create("cluster.matcherstats.match_attempt_count", Counters.MatcherStats.MatchAttemptCount);
+  Stats.create("cluster.builders.flushes", Counters.FlushStats.Flushes);
+  Stats.create("cluster.builders.flushed", Counters.FlushStats.BuildersFlushed);
+  Stats.create("cluster.builders.flushed_last", Counters.FlushStats.LastBuildersFlushed);
+  Stats.create("cluster.builders.deferred_full_flushes", Counters.FlushStats.DeferredFullFlushes);
 
   // Event stats
   Stats.create("events.count", Counters.Events);
@@ -87,8 +91,7 @@ NmxBase::NmxBase(BaseSettings const &settings) : Detector(settings) {
   // Stats.create("memory.cluster_storage.malloc_fallback_count", ClusterPoolStorage::Pool->Stats.MallocFallbackCount);
 
   // clang-format on
-  std::function<void()> inputFunc = [this]() { inputThread(); };
-  AddThreadFunction(inputFunc, "input");
+  addInputThreads();
 
   std::function<void()> processingFunc = [this]() {
     NmxBase::processing_thread();
@@ -110,19 +113,22 @@ void NmxBase::processing_thread() {
 
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
-  auto Produce = [&EventProducer](auto DataBuffer, auto Timestamp) {
-    EventProducer.produce(DataBuffer, Timestamp);
-  };
-
-  Serializer =
-      std::make_unique<EV44Serializer>(KafkaBufferSize, "nmx", Produce);
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
+  Serializer = std::make_unique<EV44Serializer>(KafkaBufferSize, "nmx",
+                                                EventProducer);
 
   Stats.create("produce.cause.pulse_change",
                Serializer->stats().ProduceRefTimeTriggered);
   Stats.create("produce.cause.max_events_reached",
                Serializer->stats().ProduceTriggeredMaxEvents);
+  Stats.create("produce.zero_copy", Serializer->stats().ProduceZeroCopy);
+  Stats.create("produce.copied", Serializer->stats().ProduceCopied);
 
   NMXInstrument NMX(Counters, EFUSettings, *Serializer, ESSHeaderParser, Stats);
+  // Readouts are processed before the ring buffer entry is reused
+  NMX.VMMParser.setInPlace(true);
 
   // Time out after one second
   Timer ProduceTimer(EFUSettings.UpdateIntervalSec * 1'000'000'000);
@@ -136,15 +142,15 @@ void NmxBase::processing_thread() {
 
     auto idle_start = local_clock::now();
 
-    if (InputFifo.pop(DataIndex)) { // There is data in the FIFO - do processing
-      auto DataLen = RxRingbuffer.getDataLength(DataIndex);
+    if (auto RxRing = popInput(DataIndex)) { // There is data - do processing
+      auto DataLen = RxRing->getDataLength(DataIndex);
       if (DataLen == 0) {
         ITCounters.FifoSeqErrors++;
         continue;
       }
 
       /// \todo use the Buffer<T> class here and in parser
-      auto DataPtr = RxRingbuffer.getDataBuffer(DataIndex);
+      auto DataPtr = RxRing->getDataBuffer(DataIndex);
 
       auto Res = ESSHeaderParser.validate(DataPtr, DataLen, DetectorType::NMX);
 
@@ -162,18 +168,20 @@ void NmxBase::processing_thread() {
       Counters.VMMStats = NMX.VMMParser.Stats;
 
       NMX.processReadouts();
+      Counters.FlushStats = NMX.Flusher.Stats;
 
-      // After each builder has generated events, we add the matcher stats to
-      // the global counters, and reset the internal matcher stats to 0
-      for (auto &builder : NMX.builders) {
+      // After each flushed builder has generated events, we add the matcher
+      // stats to the global counters, and reset the internal matcher stats
+      for (auto Index : NMX.Flusher.flushed()) {
+        auto &builder = NMX.builders[Index];
         NMX.generateEvents(builder.Events);
         Counters.MatcherStats.addAndClear(builder.matcher.Stats);
       }
 
     } else {
-      // There is NO data in the FIFO - increment idle counter and sleep a
-      // little
-      usleep(100);
+      // There is NO data in the FIFO - increment idle counter and wait
+      // for data
+      waitForInput();
       Counters.ProcessingIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
@@ -181,6 +189,18 @@ void NmxBase::processing_thread() {
 
       // Poll Kafka to handle events and delivery reports
       EventProducer.poll(0);
+
+      // Builders waiting for their flush delay are fully flushed also
+      // when no more packets arrive
+      if (NMX.Flusher.pending()) {
+        NMX.Flusher.flush(NMX.builders, true);
+        Counters.FlushStats = NMX.Flusher.Stats;
+        for (auto Index : NMX.Flusher.flushed()) {
+          auto &builder = NMX.builders[Index];
+          NMX.generateEvents(builder.Events);
+          Counters.MatcherStats.addAndClear(builder.matcher.Stats);
+        }
+      }
     }
 
     if (ProduceTimer.timeout()) {
@@ -72,6 +72,8 @@ void NMXInstrument::loadConfigAndCalib() {
           Conf.NMXFileParms.SplitMultiEventsCoefficientHigh);
     }
   }
+  Flusher = EventBuilder2DFlusher(
+      builders.size(), Conf.NMXFileParms.BuilderFlushDelayUs * 1000ULL);
 
   if (Settings.CalibFile != "") {
     XTRACE(INIT, ALW, "Loading and applying calibration file %s",
@@ -88,7 +90,7 @@ void NMXInstrument::processReadouts() {
   Serializer.checkAndSetReferenceTime(
       ESSHeaderParser.Packet.Time.getRefTimeUInt64());
   XTRACE(DATA, DEB, "processReadouts()");
-  for (const auto &readout : VMMParser.Result) {
+  for (const auto &readout : VMMParser.readouts()) {
 
     XTRACE(DATA, DEB,
            "readout: FiberId %d, FENId %d, VMM %d, Channel %d, TimeLow %d",
@@ -142,11 +144,10 @@ void NMXInstrument::processReadouts() {
     XTRACE(DATA, DEB, "Plane %u, Coord %u, Channel %u, Panel %u", Plane, Coord,
            readout.Channel, Panel);
     builders[Panel].insert({TimeNS, Coord, ADC, Plane});
+    Flusher.touch(Panel);
   }
 
-  for (auto &builder : builders) {
-    builder.flush(true); // Do matching, and flush the matcher
-  }
+  Flusher.flush(builders, true); // Do matching, and flush the matcher
 }
 
 void NMXInstrument::checkConfigAndGeometry() {
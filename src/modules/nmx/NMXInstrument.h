@@ -19,6 +19,7 @@
 #include <common/readout/vmm3/VMM3Parser.h>
 #include <common/reduction/Event.h>
 #include <common/reduction/EventBuilder2D.h>
+#include <common/reduction/EventBuilder2DFlusher.h>
 #include <logical_geometry/ESSGeometry.h>
 #include <memory>
 #include <nmx/Counters.h>
@@ -68,6 +69,9 @@ public:
   /// parsed the configuration file and know the number of cassettes
   std::vector<EventBuilder2D> builders; // reinit in ctor
 
+  /// \brief flushes the builders which received hits, reinit in ctor
+  EventBuilder2DFlusher Flusher;
+
   /// \brief Instrument configuration (rings, FENs, Hybrids, etc)
   Config Conf;
 
@@ -33,6 +33,7 @@ void Config::applyConfig() {
   assign("MaxMatchingTimeGap", NMXFileParms.MaxMatchingTimeGap);
   assign("MaxClusteringTimeGap", NMXFileParms.MaxClusteringTimeGap);
   assign("NumPanels", NMXFileParms.NumPanels);
+  assign("BuilderFlushDelayUs", NMXFileParms.BuilderFlushDelayUs);
   assign("SplitMultiEvents", NMXFileParms.SplitMultiEvents);
   assign("SplitMultiEventsCoefficientLow", NMXFileParms.SplitMultiEventsCoefficientLow);
   assign("SplitMultiEventsCoefficientHigh", NMXFileParms.SplitMultiEventsCoefficientHigh);
@@ -56,6 +56,7 @@ public:
     uint16_t MaxTimeSpan{500};
     uint16_t MaxMatchingTimeGap{500};
     uint16_t MaxClusteringTimeGap{500};
+    uint32_t BuilderFlushDelayUs{0}; ///< 0 - full flush every packet
   } NMXFileParms;
 
   // Derived parameters
@@ -17,6 +17,32 @@
 
 // clang-format off
 
+std::vector<uint8_t> TestPacket {
+              0x00, 0x00, // pad, v0
+  0x45, 0x53, 0x53, 0x44, // 'E', 'S', 'S', type 0x44
+  0x46, 0x00, 0x0B, 0x00, // len(0x005e), OQ11, TSrc0
+  0x00, 0x00, 0x00, 0x00, // PT HI
+  0x00, 0x00, 0x00, 0x00, // PT LO
+  0x00, 0x00, 0x00, 0x00, // PPT HI
+  0x00, 0x00, 0x00, 0x00, // PPT Lo
+  0x08, 0x00, 0x00, 0x00, // Seq number 8
+
+  // First readout - Hybrid 0, ASIC 1
+  0x00, 0x00, 0x14, 0x00,  // Data Header - Ring 0, FEN 0
+  0x00, 0x00, 0x00, 0x00,  // Time HI 0 s
+  0x01, 0x00, 0x00, 0x00,  // Time LO 1 tick
+  0x00, 0x00, 0x00, 0x01,  // ADC 0x100
+  0x00, 0x00, 0x02, 0x3C,  // GEO 0, TDC 0, VMM 1, CH 60
+
+  // Second readout - Hybrid 0, ASIC 0
+  0x00, 0x00, 0x14, 0x00,  // Data Header, Ring 0, FEN 0
+  0x00, 0x00, 0x00, 0x00,  // Time HI 0 s
+  0x05, 0x00, 0x00, 0x00,  // Time LO 5 ticks
+  0x00, 0x00, 0x00, 0x01,  // ADC 0x100
+  0x00, 0x00, 0x00, 0x3C,  // GEO 0, TDC 0, VMM 0, CH 60
+};
+
+// FEN 1 is not in the configuration
 std::vector<uint8_t> BadTestPacket {
               0x00, 0x00, // pad, v0
   0x45, 0x53, 0x53, 0x44, // 'E', 'S', 'S', type 0x44
@@ -112,13 +138,29 @@ TEST_F(NMXBaseTest, Constructor) {
 TEST_F(NMXBaseTest, DataReceive) {
   nmx::NmxBase Readout(Settings);
 
-  writePacketToRxFIFO(Readout, BadTestPacket);
+  writePacketToRxFIFO(Readout, TestPacket);
 
   EXPECT_EQ(Readout.Counters.VMMStats.Readouts, 2); // # readouts in TestPacket
   EXPECT_EQ(Readout.Counters.VMMStats.DataReadouts, 2);
-  // this instance of NMX has 4 event builders, each attempts
-  // matching once per packet received, so expecting counter to be 4
-  EXPECT_EQ(Readout.Counters.MatcherStats.MatchAttemptCount, 4);
+  // this instance of NMX has 4 event builders, both readouts belong to
+  // panel 0 so only that builder is flushed and attempts matching
+  EXPECT_EQ(Readout.Counters.FlushStats.Flushes, 1);
+  EXPECT_EQ(Readout.Counters.FlushStats.BuildersFlushed, 1);
+  EXPECT_EQ(Readout.Counters.MatcherStats.MatchAttemptCount, 1);
+  Readout.stopThreads();
+}
+
+TEST_F(NMXBaseTest, DataReceiveBadGeometry) {
+  nmx::NmxBase Readout(Settings);
+
+  writePacketToRxFIFO(Readout, BadTestPacket);
+
+  EXPECT_EQ(Readout.Counters.VMMStats.Readouts, 2);
+  EXPECT_EQ(Readout.Counters.VMMStats.DataReadouts, 2);
+  // no readout passes geometry validation, so no builder is flushed
+  EXPECT_EQ(Readout.Counters.FlushStats.Flushes, 1);
+  EXPECT_EQ(Readout.Counters.FlushStats.BuildersFlushed, 0);
+  EXPECT_EQ(Readout.Counters.MatcherStats.MatchAttemptCount, 0);
   Readout.stopThreads();
 }
 
@@ -52,6 +52,9 @@ void PerfGenBase::processingThread() {
   KafkaConfig KafkaCfg(EFUSettings.KafkaConfigFile);
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
 
   auto Produce = [&EventProducer](auto DataBuffer, auto Timestamp) {
     EventProducer.produce(DataBuffer, Timestamp);
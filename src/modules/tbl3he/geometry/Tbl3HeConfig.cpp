@@ -66,7 +66,8 @@ void Tbl3HeConfig::parseConfig() {
           Tbl3HeParms.NumOfFENs, Configs.size()));
     }
 
-    TopologyMapPtr.reset(new HashMap2D<Topology>(Tbl3HeParms.NumOfFENs));
+    // Indexed by Ring and FEN
+    TopologyMapPtr.reset(new DenseMap2D<Topology>(Tbl3HeParms.MaxRing + 1));
 
     for (auto &elt : Configs) {
       Json::checkKeys("Mandatory Topology keys", elt, {"Ring", "FEN", "Bank"});
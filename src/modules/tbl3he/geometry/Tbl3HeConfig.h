@@ -12,7 +12,7 @@
 #include <common/config/Config.h>
 #include <common/JsonFile.h>
 #include <common/debug/Trace.h>
-#include <common/memory/HashMap2D.h>
+#include <common/memory/DenseMap2D.h>
 #include <string>
 #include <vector>
 
@@ -53,6 +53,6 @@ class Tbl3HeConfig : public Configurations::Config {
     Topology() = default;
   };
 
-  std::unique_ptr<HashMap2D<Topology>> TopologyMapPtr;
+  std::unique_ptr<DenseMap2D<Topology>> TopologyMapPtr;
 };
 } // namespace caen
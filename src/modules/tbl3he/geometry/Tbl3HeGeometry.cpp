@@ -9,7 +9,7 @@
 ///
 //===----------------------------------------------------------------------===//
 
-#include <common/memory/HashMap2D.h>
+#include <common/memory/DenseMap2D.h>
 #include <logical_geometry/ESSGeometry.h>
 #include <modules/tbl3he/geometry/Tbl3HeGeometry.h>
 #include <tbl3he/geometry/Tbl3HeConfig.h>
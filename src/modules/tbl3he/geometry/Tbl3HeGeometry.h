@@ -25,7 +25,7 @@
 // #define TRC_LEVEL TRC_L_DEB
 
 namespace caen {
-class Tbl3HeGeometry : public Geometry, ESSGeometry {
+class Tbl3HeGeometry final : public Geometry, ESSGeometry {
 public:
   Tbl3HeGeometry(Statistics &Stats, const Config &CaenConfiguration);
 
@@ -49,6 +49,9 @@ public:
   ///< Invalid position marker
 
 protected:
+  /// calcPixelStatic() calls calcPixelImpl() directly
+  friend class DetectorGeometry<DataParser::CaenReadout>;
+
   /// \brief Calculate pixel ID from readout data for Tbl3He geometry
   /// \param Data Const reference to CaenReadout object
   /// \return Calculated pixel ID, or 0 if calculation failed
@@ -49,7 +49,7 @@ protected:
     }
 
     CaenConfiguration.Tbl3HeConf.TopologyMapPtr.reset(
-        new HashMap2D<caen::Tbl3HeConfig::Topology>(2));
+        new DenseMap2D<caen::Tbl3HeConfig::Topology>(2));
     auto topo = std::make_unique<caen::Tbl3HeConfig::Topology>(0);
     CaenConfiguration.Tbl3HeConf.TopologyMapPtr->add(0, 0, topo);
     topo = std::make_unique<caen::Tbl3HeConfig::Topology>(1);
@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, see LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -66,8 +66,7 @@ Timepix3Base::Timepix3Base(BaseSettings const &settings)
   Stats.create("produce.cause.timeout", Counters.ProduceCauseTimeout);
 
   // clang-format on
-  std::function<void()> inputFunc = [this]() { inputThread(); };
-  AddThreadFunction(inputFunc, "input");
+  addInputThreads();
 
   std::function<void()> processingFunc = [this]() {
     Timepix3Base::processingThread();
@@ -90,21 +89,34 @@ void Timepix3Base::processingThread() {
   KafkaConfig KafkaCfg(EFUSettings.KafkaConfigFile);
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
 
-  auto Produce = [&EventProducer](const auto &DataBuffer,
-                                  const auto &Timestamp) {
-    EventProducer.produce(DataBuffer, Timestamp);
-  };
-
-  EV44Serializer Serializer(KafkaBufferSize, "timepix3", Produce);
+  EV44Serializer Serializer(KafkaBufferSize, "timepix3", EventProducer);
 
   Stats.create("produce.cause.pulse_change",
                Serializer.stats().ProduceRefTimeTriggered);
   Stats.create("produce.cause.max_events_reached",
                Serializer.stats().ProduceTriggeredMaxEvents);
+  Stats.create("produce.zero_copy", Serializer.stats().ProduceZeroCopy);
+  Stats.create("produce.copied", Serializer.stats().ProduceCopied);
 
   Timepix3Instrument Timepix3(Counters, timepix3Configuration, Serializer);
 
+  ClusteringPoolStats &PoolStats =
+      Timepix3.pixelEventHandler.getClusteringPool().stats();
+  Stats.create("handlers.pixelevent.clustering.jobs", PoolStats.Jobs);
+  Stats.create("handlers.pixelevent.clustering.queue_wait_ns",
+               PoolStats.QueueWaitNs);
+  Stats.create("handlers.pixelevent.clustering.max_queue_wait_ns",
+               PoolStats.MaxQueueWaitNs);
+  for (size_t i = 0; i < PoolStats.WindowTimeNs.size(); i++) {
+    Stats.create("handlers.pixelevent.clustering.window" + std::to_string(i) +
+                     "_time_ns",
+                 PoolStats.WindowTimeNs[i]);
+  }
+
   // Time out after one second
   Timer ProduceTimer(EFUSettings.UpdateIntervalSec * 1'000'000'000);
 
@@ -116,8 +128,8 @@ void Timepix3Base::processingThread() {
 
     auto idle_start = local_clock::now();
 
-    if (InputFifo.pop(DataIndex)) { // There is data in the FIFO - do processing
-      auto DataLen = RxRingbuffer.getDataLength(DataIndex);
+    if (auto RxRing = popInput(DataIndex)) { // There is data - do processing
+      auto DataLen = RxRing->getDataLength(DataIndex);
       if (DataLen == 0) {
         ITCounters.FifoSeqErrors++;
         continue;
@@ -125,7 +137,7 @@ void Timepix3Base::processingThread() {
       XTRACE(DATA, DEB, "getting data buffer");
       /// \todo use the Buffer<T> class here and in parser?
       /// \todo avoid copying by passing reference to stats like for gdgem?
-      auto DataPtr = RxRingbuffer.getDataBuffer(DataIndex);
+      auto DataPtr = RxRing->getDataBuffer(DataIndex);
 
       XTRACE(DATA, DEB, "parsing data");
       Timepix3.timepix3Parser.parse(DataPtr, DataLen);
@@ -133,8 +145,8 @@ void Timepix3Base::processingThread() {
       XTRACE(DATA, DEB, "processing data");
       Timepix3.processReadouts();
 
-    } else { // There is NO data in the FIFO - do stop checks and sleep a little
-      usleep(100);
+    } else { // There is NO data in the FIFO - do stop checks and wait for data
+      waitForInput();
       Counters.ProcessingIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. See LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -55,7 +55,7 @@ Timepix3Instrument::Timepix3Instrument(Counters &counters,
   timepix3Parser.DataEventObservable<EVRReadout>::subscribe(
       &timingEventHandler);
 
-  timepix3Parser.DataEventObservable<PixelReadout>::subscribe(
+  timepix3Parser.DataEventObservable<PixelReadoutBatch>::subscribe(
       &pixelEventHandler);
   timingEventHandler.DataEventObservable<ESSGlobalTimeStamp>::subscribe(
       &pixelEventHandler);
@@ -10,6 +10,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 #define PIXEL_MAX_TIMESTAMP_NS 26843545600
 
@@ -278,4 +279,81 @@ struct PixelReadout {
   }
 };
 
+///
+/// \brief Pixel readouts of one packet stored as a structure of arrays.
+///
+/// Each field of PixelReadout has its own array, the readout at index i is
+/// made of the i'th element of each array. The parser fills the arrays a run
+/// of pixel words at a time and publishes the whole batch, so the handler
+/// gets one call per batch rather than one per pixel.
+///
+struct PixelReadoutBatch {
+  std::vector<uint16_t> dCol;      // < The digital columns of the pixels.
+  std::vector<uint16_t> sPix;      // < The sub pixel indexes of the pixels.
+  std::vector<uint8_t> pix;        // < The pixel indexes within the sub pixel.
+  std::vector<uint16_t> toa;       // < The Time-of-Arrival values.
+  std::vector<uint16_t> ToT;       // < The Time-over-Threshold values.
+  std::vector<uint8_t> fToA;       // < The fine Time-of-Arrival values.
+  std::vector<uint32_t> spidrTime; // < The SPIDR timestamps.
+
+  /// \brief Number of pixel readouts in the batch.
+  size_t size() const { return dCol.size(); }
+
+  /// \brief Returns true if the batch has no pixel readouts.
+  bool empty() const { return dCol.empty(); }
+
+  /// \brief Sets the number of pixel readouts, new readouts are zero.
+  void resize(size_t Size) {
+    dCol.resize(Size);
+    sPix.resize(Size);
+    pix.resize(Size);
+    toa.resize(Size);
+    ToT.resize(Size);
+    fToA.resize(Size);
+    spidrTime.resize(Size);
+  }
+
+  /// \brief Reserves space for Size pixel readouts in all arrays.
+  void reserve(size_t Size) {
+    dCol.reserve(Size);
+    sPix.reserve(Size);
+    pix.reserve(Size);
+    toa.reserve(Size);
+    ToT.reserve(Size);
+    fToA.reserve(Size);
+    spidrTime.reserve(Size);
+  }
+
+  /// \brief Removes all pixel readouts, keeping the allocated space.
+  void clear() { resize(0); }
+
+  /// \brief Appends a single pixel readout to the batch.
+  void push_back(const PixelReadout &Readout) {
+    dCol.push_back(Readout.dCol);
+    sPix.push_back(Readout.sPix);
+    pix.push_back(Readout.pix);
+    toa.push_back(Readout.toa);
+    ToT.push_back(Readout.ToT);
+    fToA.push_back(Readout.fToA);
+    spidrTime.push_back(Readout.spidrTime);
+  }
+
+  /// \brief Returns the pixel readout at index i.
+  PixelReadout operator[](size_t i) const {
+    return {dCol[i], sPix[i], pix[i], toa[i], ToT[i], fToA[i], spidrTime[i]};
+  }
+
+  ///
+  /// \brief Compares two PixelReadoutBatch objects for equality.
+  ///
+  /// \param other The other PixelReadoutBatch object to compare.
+  /// \return true if all pixel readouts are equal, false otherwise.
+  ///
+  bool operator==(const PixelReadoutBatch &other) const {
+    return dCol == other.dCol && sPix == other.sPix && pix == other.pix &&
+           ToT == other.ToT && fToA == other.fToA && toa == other.toa &&
+           spidrTime == other.spidrTime;
+  }
+};
+
 } // namespace timepixReadout
\ No newline at end of file
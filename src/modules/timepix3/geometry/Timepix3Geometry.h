@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. See LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -54,7 +54,13 @@ public:
   // Calculation and naming (Col and Row) is taken over from CFEL-CMI pymepix
   // https://github.com/CFEL-CMI/pymepix/blob/develop/pymepix/processing/logic/packet_processor.py
   static inline uint32_t calcX(const timepixReadout::PixelReadout &Data) {
-    uint32_t Col = static_cast<uint32_t>(Data.dCol) + Data.pix / 4;
+    return calcX(Data.dCol, Data.pix);
+  }
+
+  /// \brief calculated the X coordinate from the dCol and pix fields, used
+  /// for the arrays of a PixelReadoutBatch
+  static inline uint32_t calcX(uint16_t DCol, uint8_t Pix) {
+    uint32_t Col = static_cast<uint32_t>(DCol) + Pix / 4;
     return Col;
   }
 
@@ -62,7 +68,13 @@ public:
   // Calculation and naming (Col and Row) is taken over from CFEL-CMI pymepix
   // https://github.com/CFEL-CMI/pymepix/blob/develop/pymepix/processing/logic/packet_processor.py
   static inline uint32_t calcY(const timepixReadout::PixelReadout &Data) {
-    uint32_t Row = static_cast<uint32_t>(Data.sPix) + (Data.pix & 0x3);
+    return calcY(Data.sPix, Data.pix);
+  }
+
+  /// \brief calculated the Y coordinate from the sPix and pix fields, used
+  /// for the arrays of a PixelReadoutBatch
+  static inline uint32_t calcY(uint16_t SPix, uint8_t Pix) {
+    uint32_t Row = static_cast<uint32_t>(SPix) + (Pix & 0x3);
     return Row;
   }
 
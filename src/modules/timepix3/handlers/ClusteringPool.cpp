@@ -0,0 +1,115 @@
+// Copyright (C) 2026 European Spallation Source, see LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Implementation of the persistent worker threads clustering the
+/// Timepix3 sub frames
+//===----------------------------------------------------------------------===//
+
+#include <common/debug/Trace.h>
+#include <timepix3/handlers/ClusteringPool.h>
+
+// #undef TRC_LEVEL
+// #define TRC_LEVEL TRC_L_DEB
+
+namespace timepix3 {
+
+using namespace std::chrono;
+
+ClusteringPool::ClusteringPool(size_t NumWindows, size_t NumThreads,
+                               uint64_t MaxTimeGapNS,
+                               uint16_t MaxCoordinateGap) {
+  for (size_t i = 0; i < NumWindows; i++) {
+    Clusterers.push_back(std::make_unique<Hierarchical2DClusterer>(
+        MaxTimeGapNS, MaxCoordinateGap));
+  }
+  Stats.WindowTimeNs.resize(NumWindows);
+
+  if (NumThreads < 2) {
+    return;
+  }
+
+  XTRACE(INIT, ALW, "Starting %zu clustering threads for %zu windows",
+         NumThreads, NumWindows);
+  for (size_t i = 0; i < NumThreads; i++) {
+    Workers.emplace_back(&ClusteringPool::workerThread, this);
+  }
+}
+
+ClusteringPool::~ClusteringPool() {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Stop = true;
+  }
+  JobReady.notify_all();
+  for (auto &Worker : Workers) {
+    Worker.join();
+  }
+}
+
+void ClusteringPool::cluster(std::vector<Hit2DVector> &SubFrames) {
+  if (Workers.empty()) {
+    for (size_t i = 0; i < SubFrames.size(); i++) {
+      if (not SubFrames[i].empty()) {
+        Stats.Jobs++;
+        clusterWindow(i, SubFrames[i]);
+      }
+    }
+  } else {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    auto Now = steady_clock::now();
+    for (size_t i = 0; i < SubFrames.size(); i++) {
+      if (not SubFrames[i].empty()) {
+        Queue.push_back({i, &SubFrames[i], Now});
+        Pending++;
+        Stats.Jobs++;
+      }
+    }
+    JobReady.notify_all();
+    JobsDone.wait(Lock, [this] { return Pending == 0; });
+  }
+
+  for (auto &SubFrame : SubFrames) {
+    SubFrame.clear();
+  }
+}
+
+void ClusteringPool::workerThread() {
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (true) {
+    JobReady.wait(Lock, [this] { return Stop or not Queue.empty(); });
+    if (Queue.empty()) {
+      return;
+    }
+
+    Job Next = Queue.front();
+    Queue.pop_front();
+    int64_t WaitNs =
+        duration_cast<nanoseconds>(steady_clock::now() - Next.Queued).count();
+    Stats.QueueWaitNs += WaitNs;
+    Stats.MaxQueueWaitNs = std::max(Stats.MaxQueueWaitNs, WaitNs);
+
+    Lock.unlock();
+    clusterWindow(Next.Window, *Next.Hits);
+    Lock.lock();
+
+    if (--Pending == 0) {
+      JobsDone.notify_one();
+    }
+  }
+}
+
+void ClusteringPool::clusterWindow(size_t Window, Hit2DVector &Hits) {
+  auto Start = steady_clock::now();
+
+  // sort hits by time of flight for clustering in time
+  sort_chronologically(std::move(Hits));
+  Clusterers[Window]->cluster(Hits);
+  Clusterers[Window]->flush();
+
+  Stats.WindowTimeNs[Window] +=
+      duration_cast<nanoseconds>(steady_clock::now() - Start).count();
+}
+
+} // namespace timepix3
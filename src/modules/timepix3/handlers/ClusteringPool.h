@@ -0,0 +1,121 @@
+// Copyright (C) 2026 European Spallation Source, see LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Persistent worker threads clustering the Timepix3 sub frames
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <chrono>
+#include <common/reduction/Hit2DVector.h>
+#include <common/reduction/clustering/Hierarchical2DClusterer.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace timepix3 {
+
+///
+/// \brief Statistics of the ClusteringPool
+///
+/// Jobs and the queue wait times are updated with the pool mutex held, each
+/// entry of WindowTimeNs only by the thread clustering that window.
+///
+struct ClusteringPoolStats {
+  int64_t Jobs{0};        ///< Number of sub frames clustered
+  int64_t QueueWaitNs{0}; ///< Total time sub frames waited for a thread
+  int64_t MaxQueueWaitNs{0}; ///< Longest time a sub frame waited for a thread
+  std::vector<int64_t>
+      WindowTimeNs; ///< Total sort and clustering time per window
+};
+
+///
+/// \brief Owns one Hierarchical2DClusterer per sub frame (window) and a fixed
+/// number of worker threads which are started once and kept for the lifetime
+/// of the pool.
+///
+/// Each call to cluster() queues the non empty sub frames, wakes the workers
+/// and waits until all of them are clustered. With fewer than two threads the
+/// sub frames are clustered by the calling thread and no threads are started.
+///
+class ClusteringPool {
+public:
+  ///
+  /// \brief Creates the clusterers and starts the worker threads.
+  ///
+  /// \param NumWindows number of sub frames, one clusterer per sub frame.
+  /// \param NumThreads number of worker threads.
+  /// \param MaxTimeGapNS maximum time gap for the clusterers.
+  /// \param MaxCoordinateGap maximum coordinate gap for the clusterers.
+  ///
+  ClusteringPool(size_t NumWindows, size_t NumThreads, uint64_t MaxTimeGapNS,
+                 uint16_t MaxCoordinateGap);
+
+  ///
+  /// \brief Stops and joins the worker threads.
+  ///
+  ~ClusteringPool();
+
+  ClusteringPool(const ClusteringPool &) = delete;
+  ClusteringPool &operator=(const ClusteringPool &) = delete;
+
+  ///
+  /// \brief Sorts and clusters the hits of each non empty sub frame with the
+  /// clusterer of that window, then clears the sub frames.
+  ///
+  /// Returns when all sub frames are clustered, the clusters are then found
+  /// in clusterer(Window).clusters.
+  ///
+  /// \param SubFrames the hits for each window, must have NumWindows entries.
+  ///
+  void cluster(std::vector<Hit2DVector> &SubFrames);
+
+  /// \brief returns the clusterer of the given window
+  Hierarchical2DClusterer &clusterer(size_t Window) {
+    return *Clusterers[Window];
+  }
+
+  /// \brief returns the number of windows (clusterers)
+  size_t windows() const { return Clusterers.size(); }
+
+  /// \brief returns the number of worker threads, 0 if clustering is done by
+  /// the calling thread
+  size_t threads() const { return Workers.size(); }
+
+  /// \brief returns the pool statistics
+  ClusteringPoolStats &stats() { return Stats; }
+
+private:
+  /// \brief sub frame queued for clustering
+  struct Job {
+    size_t Window;
+    Hit2DVector *Hits;
+    std::chrono::steady_clock::time_point Queued;
+  };
+
+  /// \brief loop run by each worker thread
+  void workerThread();
+
+  /// \brief sorts and clusters the hits of a single window
+  void clusterWindow(size_t Window, Hit2DVector &Hits);
+
+  std::vector<std::unique_ptr<Hierarchical2DClusterer>> Clusterers;
+  std::vector<std::thread> Workers;
+
+  std::mutex Mutex;                 ///< protects the members below
+  std::condition_variable JobReady; ///< signals queued jobs or Stop
+  std::condition_variable JobsDone; ///< signals Pending reached zero
+  std::deque<Job> Queue;
+  size_t Pending{0}; ///< queued or running jobs
+  bool Stop{false};
+
+  ClusteringPoolStats Stats;
+};
+
+} // namespace timepix3
@@ -1,4 +1,4 @@
-// Copyright (C) 2024 - 2025 European Spallation Source, see LICENSE file
+// Copyright (C) 2024 - 2026 European Spallation Source, see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -8,7 +8,6 @@
 //===----------------------------------------------------------------------===//
 
 #include <common/debug/Trace.h>
-#include <future>
 #include <common/time/ESSTime.h>
 #include <timepix3/handlers/PixelEventHandler.h>
 #include <timepix3/handlers/TimingEventHandler.h>
@@ -29,18 +28,12 @@ PixelEventHandler::PixelEventHandler(Counters &statCounters,
                                      const Config &timepix3Configuration)
     : statCounters(statCounters), geometry(geometry), serializer(serializer),
       TimepixConfiguration(timepix3Configuration),
-      FrequencyPeriodNs(hzToNanoseconds(timepix3Configuration.FrequencyHz)) {
-
-  clusterers.resize(geometry->getChunkNumber());
-  sub2DFrames.resize(geometry->getChunkNumber());
-
-  for (int i = 0; i < geometry->getChunkNumber(); i++) {
-    clusterers[i] = std::make_unique<Hierarchical2DClusterer>(
-        Hierarchical2DClusterer(TimepixConfiguration.MaxTimeGapNS,
-                                timepix3Configuration.MaxCoordinateGap));
-    sub2DFrames[i] = Hit2DVector();
-  }
-}
+      FrequencyPeriodNs(hzToNanoseconds(timepix3Configuration.FrequencyHz)),
+      sub2DFrames(geometry->getChunkNumber()),
+      clusteringPool(geometry->getChunkNumber(),
+                     timepix3Configuration.ParallelThreads,
+                     timepix3Configuration.MaxTimeGapNS,
+                     timepix3Configuration.MaxCoordinateGap) {}
 
 void PixelEventHandler::applyData(const ESSGlobalTimeStamp &epochEssPulseTime) {
 
@@ -80,48 +73,61 @@ void PixelEventHandler::applyData(const PixelReadout &pixelReadout) {
       {pixelGlobalTimeStamp, X, Y, pixelReadout.ToT});
 }
 
-void PixelEventHandler::clusterHits(Hierarchical2DClusterer &clusterer,
-                                    Hit2DVector &hitsVector) {
-
-  // sort hits by time of flight for clustering in time
-  sort_chronologically(std::move(hitsVector));
-  clusterer.cluster(hitsVector);
-  clusterer.flush();
-}
-
-void PixelEventHandler::pushDataToKafka() {
-
-  std::vector<std::future<void>> futures;
+void PixelEventHandler::applyData(const PixelReadoutBatch &pixelReadouts) {
+  const size_t Size = pixelReadouts.size();
+  const uint32_t NX = geometry->nx();
+  const uint32_t NY = geometry->ny();
 
-  int sub2DFramesNumber = sub2DFrames.size();
+  batchX.resize(Size);
+  batchY.resize(Size);
+  for (size_t i = 0; i < Size; i++) {
+    batchX[i] =
+        Timepix3Geometry::calcX(pixelReadouts.dCol[i], pixelReadouts.pix[i]);
+  }
+  for (size_t i = 0; i < Size; i++) {
+    batchY[i] =
+        Timepix3Geometry::calcY(pixelReadouts.sPix[i], pixelReadouts.pix[i]);
+  }
 
-  if (sub2DFramesNumber == 1) {
-    clusterHits(*clusterers[0], sub2DFrames[0]);
-  } else {
-    /// \todo parallel processing of the subFrames not yet finalized and this
-    /// part not tested. Finish the implementation for parallel processing.
-    for (int i = 0; i < sub2DFramesNumber; i++) {
-      auto &subFrame = sub2DFrames[i];
-      if (subFrame.size() > 0) {
-        futures.push_back(
-            std::async(std::launch::async, &PixelEventHandler::clusterHits,
-                       this, std::ref(*clusterers[i]), std::ref(subFrame)));
+  if (lastEpochESSPulseTime == nullptr) {
+    for (size_t i = 0; i < Size; i++) {
+      if (batchX[i] >= NX or batchY[i] >= NY) {
+        statCounters.InvalidPixelReadout++;
+      } else {
+        statCounters.NoGlobalTime++;
       }
     }
+    XTRACE(DATA, WAR, "No epoch pulse time, skipping %zu readouts", Size);
+    return;
+  }
 
-    if (!futures.empty()) {
-      for (auto &future : futures) {
-        future.wait();
-      }
-    }
+  batchGlobalTime.resize(Size);
+  for (size_t i = 0; i < Size; i++) {
+    batchGlobalTime[i] =
+        calculateGlobalTime(pixelReadouts.toa[i], pixelReadouts.fToA[i],
+                            pixelReadouts.spidrTime[i]);
   }
 
-  for (auto &window : sub2DFrames) {
-    window.clear();
+  for (size_t i = 0; i < Size; i++) {
+    if (batchX[i] >= NX or batchY[i] >= NY) {
+      XTRACE(DATA, WAR, "Invalid Data, skipping readout");
+      statCounters.InvalidPixelReadout++;
+      continue;
+    }
+    uint16_t X = batchX[i];
+    uint16_t Y = batchY[i];
+
+    int windowIndex = geometry->getChunkWindowIndex(X, Y);
+    sub2DFrames[windowIndex].push_back(
+        {batchGlobalTime[i], X, Y, pixelReadouts.ToT[i]});
   }
+}
+
+void PixelEventHandler::pushDataToKafka() {
+  clusteringPool.cluster(sub2DFrames);
 
-  for (auto &cluster : clusterers) {
-    publishEvents(cluster->clusters);
+  for (size_t i = 0; i < clusteringPool.windows(); i++) {
+    publishEvents(clusteringPool.clusterer(i).clusters);
   }
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2024 - 2025 European Spallation Source, see LICENSE file
+// Copyright (C) 2024 - 2026 European Spallation Source, see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -16,6 +16,7 @@
 #include <modules/timepix3/dto/TimepixDataTypes.h>
 #include <modules/timepix3/geometry/Config.h>
 #include <modules/timepix3/geometry/Timepix3Geometry.h>
+#include <modules/timepix3/handlers/ClusteringPool.h>
 
 namespace timepix3 {
 
@@ -29,17 +30,18 @@ namespace timepix3 {
 /// to Kafka.
 ///
 /// The class can split the 2D frame into sub frames and process them in
-/// parallel.
+/// parallel on a ClusteringPool.
 ///
 /// The PixelEventHandler class also contains private member variables for
-/// counters, geometry, serializer, and lastEpochESSPulseTime. It uses a vector
-/// of Hierarchical2DClusterer objects and a vector of Hit2DVector objects for
-/// clustering pixel hits.
+/// counters, geometry, serializer, and lastEpochESSPulseTime. It uses a
+/// ClusteringPool and a vector of Hit2DVector objects for clustering pixel
+/// hits.
 ///
 /// \see Observer::DataEventObserver
 ///
 class PixelEventHandler
     : public observer::DataEventObserver<timepixReadout::PixelReadout>,
+      public observer::DataEventObserver<timepixReadout::PixelReadoutBatch>,
       public observer::DataEventObserver<timepixDTO::ESSGlobalTimeStamp> {
 
 private:
@@ -60,14 +62,19 @@ private:
   std::unique_ptr<timepixDTO::ESSGlobalTimeStamp> lastEpochESSPulseTime =
       nullptr; /// < Unique pointer to the last epoch ESS pulse time.
 
-  std::vector<std::unique_ptr<Hierarchical2DClusterer>>
-      clusterers; /// < Vector of unique pointers to Hierarchical2DClusterer
-                  /// objects for clustering pixel hits.
   std::vector<Hit2DVector>
       sub2DFrames; /// < Vector of Hit2DVector objects for
-                   /// storing clustered hits for sub frames
+                   /// storing hits for sub frames
                    /// in case of parallel processing
 
+  ClusteringPool clusteringPool; /// < Clusterers and worker threads for
+                                 /// clustering the sub frames
+
+  std::vector<uint32_t> batchX; /// < X coordinates of the current batch
+  std::vector<uint32_t> batchY; /// < Y coordinates of the current batch
+  std::vector<uint64_t>
+      batchGlobalTime; /// < Global times of the current batch
+
   ///
   /// \brief Publishes the clustered events to the appropriate kafka topic.
   ///
@@ -79,20 +86,6 @@ private:
   ///
   void publishEvents(Cluster2DContainer &clusters);
 
-  ///
-  /// \brief Clusters the pixel hits using the specified Hierarchical2DClusterer
-  /// object.
-  ///
-  /// This method takes a Hierarchical2DClusterer object and a Hit2DVector
-  /// object as input. It clusters the pixel hits using the specified clusterer
-  /// and stores the clustered hits in the windows vector.
-  ///
-  /// \param clusterer The Hierarchical2DClusterer object used for clustering.
-  /// \param hitsVector The Hit2DVector object containing the pixel hits to be
-  /// clustered.
-  ///
-  void clusterHits(Hierarchical2DClusterer &clusterer, Hit2DVector &hitsVector);
-
   ///
   /// \brief Calculates the global time based on the pixel time over threshold
   /// (ToT), fine time over amplitude (fToA), and SPIDR time.
@@ -145,6 +138,19 @@ public:
   ///
   void applyData(const timepixReadout::PixelReadout &pixelDataEvent) override;
 
+  ///
+  /// \brief Applies a batch of pixel data to the PixelEventHandler.
+  ///
+  /// Gives the same hits and counters as applying each pixel readout of the
+  /// batch in order, but the coordinates and global times are calculated
+  /// over the arrays of the batch.
+  ///
+  /// \param pixelReadouts The timepixReadout::PixelReadoutBatch object
+  /// containing the pixel data of a packet.
+  ///
+  void
+  applyData(const timepixReadout::PixelReadoutBatch &pixelReadouts) override;
+
   ///
   /// \brief Applies the epoch ESS pulse time data to the PixelEventHandler.
   ///
@@ -162,9 +168,15 @@ public:
   ///
   /// \brief Pushes the data to Kafka.
   ///
-  /// This method pushes the data to Kafka.
+  /// This method clusters the hits of all sub frames on the clustering pool
+  /// and pushes the resulting events to Kafka.
   ///
   void pushDataToKafka();
+
+  ///
+  /// \brief Returns the pool clustering the sub frames, for statistics.
+  ///
+  ClusteringPool &getClusteringPool() { return clusteringPool; }
 };
 
 } // namespace timepix3
\ No newline at end of file
@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. See LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -75,19 +75,22 @@ int DataParser::parse(const char *Buffer, unsigned int Size) {
     // pixel readout, identifies where a pixel on the camera was activated
     if (ReadoutType == PIXEL_READOUT_TYPE_CONST) {
 
-      PixelReadout pixelDataEvent(
-          (*DataBytesPtr & PIXEL_DCOL_MASK) >> PIXEL_DCOL_OFFSET,
-          (*DataBytesPtr & PIXEL_SPIX_MASK) >> PIXEL_SPIX_OFFSET,
-          (*DataBytesPtr & PIXEL_PIX_MASK) >> PIXEL_PIX_OFFSET,
-          (*DataBytesPtr & PIXEL_TOA_MASK) >> PIXEL_TOA_OFFSET,
-          (*DataBytesPtr & PIXEL_TOT_MASK) >> PIXEL_TOT_OFFSET,
-          (*DataBytesPtr & PIXEL_FTOA_MASK) >> PIXEL_FTOA_OFFSET,
-          *DataBytesPtr & PIXEL_SPTIME_MASK);
+      // pixel readouts come in long runs, find the end of this run and
+      // decode all of it at once
+      size_t MaxWords = BytesLeft / sizeof(*DataBytesPtr);
+      size_t Words = 1;
+      while (Words < MaxWords and ((DataBytesPtr[Words] & TYPE_MASK) >>
+                                   TYPE_OFFS) == PIXEL_READOUT_TYPE_CONST) {
+        Words++;
+      }
 
-      DataEventObservable<PixelReadout>::publishData(pixelDataEvent);
+      decodePixels(DataBytesPtr, Words);
 
-      ParsedReadouts++;
-      Stats.PixelReadouts++;
+      ParsedReadouts += Words;
+      Stats.PixelReadouts += Words;
+      BytesLeft -= Words * sizeof(*DataBytesPtr);
+      DataPtr += Words * sizeof(*DataBytesPtr);
+      continue;
 
       // TDC readout type, indicating when the camera received a TDC pulse. In
       // the ESS setup, this should correspond to an EVR pulse, indicating the
@@ -105,6 +108,9 @@ int DataParser::parse(const char *Buffer, unsigned int Size) {
       ParsedReadouts++;
       Stats.TDCReadoutCounter++;
 
+      // pixels before the TDC readout belong to the previous pulse
+      publishPixels();
+
       // TDC readouts can belong to one of two channels, and can either
       // indicate the rising or the falling edge of the signal. The camera
       // setup will determine which of these are sent.
@@ -137,7 +143,51 @@ int DataParser::parse(const char *Buffer, unsigned int Size) {
     BytesLeft -= sizeof(*DataBytesPtr);
     DataPtr += sizeof(*DataBytesPtr);
   }
+  publishPixels();
   return ParsedReadouts;
 }
 
+void DataParser::decodePixels(const uint64_t *Words, size_t Count) {
+  size_t Offset = PixelBatch.size();
+  PixelBatch.resize(Offset + Count);
+
+  uint16_t *DCol = PixelBatch.dCol.data() + Offset;
+  for (size_t i = 0; i < Count; i++) {
+    DCol[i] = (Words[i] & PIXEL_DCOL_MASK) >> PIXEL_DCOL_OFFSET;
+  }
+  uint16_t *SPix = PixelBatch.sPix.data() + Offset;
+  for (size_t i = 0; i < Count; i++) {
+    SPix[i] = (Words[i] & PIXEL_SPIX_MASK) >> PIXEL_SPIX_OFFSET;
+  }
+  uint8_t *Pix = PixelBatch.pix.data() + Offset;
+  for (size_t i = 0; i < Count; i++) {
+    Pix[i] = (Words[i] & PIXEL_PIX_MASK) >> PIXEL_PIX_OFFSET;
+  }
+  uint16_t *ToA = PixelBatch.toa.data() + Offset;
+  for (size_t i = 0; i < Count; i++) {
+    ToA[i] = (Words[i] & PIXEL_TOA_MASK) >> PIXEL_TOA_OFFSET;
+  }
+  uint16_t *ToT = PixelBatch.ToT.data() + Offset;
+  for (size_t i = 0; i < Count; i++) {
+    ToT[i] = (Words[i] & PIXEL_TOT_MASK) >> PIXEL_TOT_OFFSET;
+  }
+  uint8_t *FToA = PixelBatch.fToA.data() + Offset;
+  for (size_t i = 0; i < Count; i++) {
+    FToA[i] = (Words[i] & PIXEL_FTOA_MASK) >> PIXEL_FTOA_OFFSET;
+  }
+  uint32_t *SpidrTime = PixelBatch.spidrTime.data() + Offset;
+  for (size_t i = 0; i < Count; i++) {
+    SpidrTime[i] = Words[i] & PIXEL_SPTIME_MASK;
+  }
+}
+
+void DataParser::publishPixels() {
+  if (PixelBatch.empty()) {
+    return;
+  }
+  XTRACE(DATA, DEB, "publishing %zu pixel readouts", PixelBatch.size());
+  DataEventObservable<PixelReadoutBatch>::publishData(PixelBatch);
+  PixelBatch.clear();
+}
+
 } // namespace timepix3
@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, see LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, see LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -61,7 +61,7 @@ namespace timepix3 {
 class DataParser
     : public observer::DataEventObservable<timepixReadout::TDCReadout>,
       public observer::DataEventObservable<timepixReadout::EVRReadout>,
-      public observer::DataEventObservable<timepixReadout::PixelReadout> {
+      public observer::DataEventObservable<timepixReadout::PixelReadoutBatch> {
 public:
   const unsigned int MaxReadoutsInPacket{500};
 
@@ -69,11 +69,28 @@ public:
 
   ~DataParser(){};
 
+  /// \brief parses a packet of readouts
+  ///
+  /// Pixel readouts are collected into a PixelReadoutBatch which is
+  /// published when a TDC readout is found and at the end of the packet, so
+  /// the order of pixel and TDC readouts is kept.
+  /// \return number of parsed readouts
   int parse(const char *buffer, unsigned int size);
 
   struct Counters &Stats;
 
 private:
+  /// \brief decodes Count consecutive pixel words and appends them to
+  /// PixelBatch. Each field is extracted by its own loop over the words so
+  /// the mask and shift can be vectorized.
+  void decodePixels(const uint64_t *Words, size_t Count);
+
+  /// \brief publishes PixelBatch, if not empty, and clears it
+  void publishPixels();
+
+  /// Pixel readouts not yet published, reused between packets
+  timepixReadout::PixelReadoutBatch PixelBatch;
+
   // Const expression
   static constexpr uint8_t PIXEL_READOUT_TYPE_CONST = 11;
   static constexpr uint8_t TDC_READOUT_TYPE_CONST = 6;
@@ -0,0 +1,107 @@
+// Copyright (C) 2026 European Spallation Source, ERIC. See LICENSE file
+//===----------------------------------------------------------------------===//
+///
+/// \file
+///
+/// \brief Unit tests for the Timepix3 ClusteringPool
+//===----------------------------------------------------------------------===//
+
+#include <common/testutils/TestBase.h>
+#include <modules/timepix3/handlers/ClusteringPool.h>
+
+using namespace timepix3;
+
+class Timepix3ClusteringPoolTest : public TestBase {
+protected:
+  static constexpr size_t Windows{4};
+  static constexpr uint64_t MaxTimeGapNS{10};
+  static constexpr uint16_t MaxCoordinateGap{2};
+
+  // Two clusters per window, the hits are not in time order
+  std::vector<Hit2DVector> makeSubFrames() {
+    std::vector<Hit2DVector> SubFrames(Windows);
+    for (size_t i = 0; i < Windows; i++) {
+      uint16_t X = 10 * i;
+      SubFrames[i].push_back({1005, X, 5, 1});
+      SubFrames[i].push_back({1000, X, 5, 1});
+      SubFrames[i].push_back({1002, uint16_t(X + 1), 5, 1});
+      SubFrames[i].push_back({5000, X, 6, 1});
+      SubFrames[i].push_back({5003, X, 7, 1});
+    }
+    return SubFrames;
+  }
+};
+
+TEST_F(Timepix3ClusteringPoolTest, Constructor) {
+  ClusteringPool Inline(Windows, 1, MaxTimeGapNS, MaxCoordinateGap);
+  ASSERT_EQ(Inline.windows(), Windows);
+  ASSERT_EQ(Inline.threads(), 0);
+  ASSERT_EQ(Inline.stats().WindowTimeNs.size(), Windows);
+
+  ClusteringPool Threaded(Windows, 3, MaxTimeGapNS, MaxCoordinateGap);
+  ASSERT_EQ(Threaded.windows(), Windows);
+  ASSERT_EQ(Threaded.threads(), 3);
+}
+
+TEST_F(Timepix3ClusteringPoolTest, ThreadedSameAsInline) {
+  ClusteringPool Inline(Windows, 1, MaxTimeGapNS, MaxCoordinateGap);
+  ClusteringPool Threaded(Windows, 4, MaxTimeGapNS, MaxCoordinateGap);
+
+  for (int Pulse = 0; Pulse < 20; Pulse++) {
+    auto InlineFrames = makeSubFrames();
+    auto ThreadedFrames = makeSubFrames();
+    Inline.cluster(InlineFrames);
+    Threaded.cluster(ThreadedFrames);
+
+    for (size_t i = 0; i < Windows; i++) {
+      ASSERT_TRUE(InlineFrames[i].empty());
+      ASSERT_TRUE(ThreadedFrames[i].empty());
+
+      auto &Expected = Inline.clusterer(i).clusters;
+      auto &Clusters = Threaded.clusterer(i).clusters;
+      ASSERT_EQ(Expected.size(), 2);
+      ASSERT_EQ(Clusters.size(), Expected.size());
+      auto E = Expected.begin();
+      for (auto &Cluster : Clusters) {
+        ASSERT_EQ(Cluster.hitCount(), E->hitCount());
+        ASSERT_EQ(Cluster.timeStart(), E->timeStart());
+        ASSERT_EQ(Cluster.xCoordCenter(), E->xCoordCenter());
+        ASSERT_EQ(Cluster.yCoordCenter(), E->yCoordCenter());
+        E++;
+      }
+      Expected.clear();
+      Clusters.clear();
+    }
+  }
+
+  ASSERT_EQ(Inline.stats().Jobs, 20 * Windows);
+  ASSERT_EQ(Threaded.stats().Jobs, 20 * Windows);
+  ASSERT_EQ(Inline.stats().QueueWaitNs, 0);
+  ASSERT_GE(Threaded.stats().QueueWaitNs, Threaded.stats().MaxQueueWaitNs);
+  for (size_t i = 0; i < Windows; i++) {
+    ASSERT_GT(Threaded.stats().WindowTimeNs[i], 0);
+  }
+}
+
+TEST_F(Timepix3ClusteringPoolTest, EmptySubFramesSkipped) {
+  ClusteringPool Pool(Windows, 2, MaxTimeGapNS, MaxCoordinateGap);
+  std::vector<Hit2DVector> SubFrames(Windows);
+  SubFrames[2].push_back({1000, 3, 3, 1});
+
+  Pool.cluster(SubFrames);
+  ASSERT_EQ(Pool.stats().Jobs, 1);
+  ASSERT_EQ(Pool.stats().WindowTimeNs[0], 0);
+  ASSERT_GT(Pool.stats().WindowTimeNs[2], 0);
+  ASSERT_EQ(Pool.clusterer(2).clusters.size(), 1);
+  ASSERT_TRUE(Pool.clusterer(0).clusters.empty());
+  ASSERT_TRUE(SubFrames[2].empty());
+
+  // nothing to cluster, returns without waiting
+  Pool.cluster(SubFrames);
+  ASSERT_EQ(Pool.stats().Jobs, 1);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
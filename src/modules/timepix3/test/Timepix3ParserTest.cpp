@@ -1,4 +1,4 @@
-// Copyright (C) 2023 - 2025 European Spallation Source, ERIC. See LICENSE file
+// Copyright (C) 2023 - 2026 European Spallation Source, ERIC. See LICENSE file
 //===----------------------------------------------------------------------===//
 ///
 /// \file
@@ -8,6 +8,7 @@
 #include <common/testutils/TestBase.h>
 #include <dto/TimepixDataTypes.h>
 #include <memory>
+#include <string>
 #include <modules/timepix3/Counters.h>
 #include <modules/timepix3/test/TimepixTestHelper.h>
 #include <timepix3/readout/DataParser.h>
@@ -92,11 +93,39 @@ std::vector<uint8_t> TDCAndPixelReadout{
   0x92, 0x00, 0xd3, 0x4c, // spdr(u16): 146. ftoa(u4): 3, tot(u10): 205
   0xc0, 0x97, 0x01, 0xb1  // toa(u14): 7937, dcol(u8): 16, spix(u7): 12, pix(u1): 1
 };
+
+std::vector<uint8_t> PixelTDCPixelReadouts{
+  // Two pixel readouts
+  0x92, 0x00, 0xd3, 0x4c, // spdr(u16): 146. ftoa(u4): 3, tot(u10): 205
+  0xc0, 0x97, 0x01, 0xb1, // toa(u14): 7937, dcol(u8): 16, spix(u7): 12, pix(u1): 1
+  0x92, 0x00, 0xd3, 0x4c, // spdr(u16): 146. ftoa(u4): 3, tot(u10): 205
+  0xc0, 0x97, 0x01, 0xb1, // toa(u14): 7937, dcol(u8): 16, spix(u7): 12, pix(u1): 1
+  // Single TDC readout
+  0xe0, 0xff, 0xff, 0xff, // timestamp(u35): 34359738367, stamp(u5): 15
+  0xff, 0xff, 0xff, 0x6f, // header(u4): 6, type(u4): 15, triggercounter(u12): 4095
+  // Single pixel readout
+  0x92, 0x00, 0xd3, 0x4c, // spdr(u16): 146. ftoa(u4): 3, tot(u10): 205
+  0xc0, 0x97, 0x01, 0xb1  // toa(u14): 7937, dcol(u8): 16, spix(u7): 12, pix(u1): 1
+};
 // clang-format on
 
 class TDCReadoutHandler : public MockupDataEventReceiver<TDCReadout> {};
 class EVRReadoutHandler : public MockupDataEventReceiver<EVRReadout> {};
-class PixelReadoutHandler : public MockupDataEventReceiver<PixelReadout> {};
+class PixelReadoutHandler : public MockupDataEventReceiver<PixelReadoutBatch> {
+};
+
+// Records the order of published pixel batches and TDC readouts
+class ReadoutOrderRecorder : public DataEventObserver<PixelReadoutBatch>,
+                             public DataEventObserver<TDCReadout> {
+public:
+  std::vector<std::string> Order;
+
+  void applyData(const PixelReadoutBatch &Batch) override {
+    Order.push_back("pixels " + std::to_string(Batch.size()));
+  }
+
+  void applyData(const TDCReadout &) override { Order.push_back("tdc"); }
+};
 
 class Timepix3ParserTest : public TestBase {
 protected:
@@ -114,7 +143,7 @@ protected:
 
     timepix3Parser.DataEventObservable<TDCReadout>::subscribe(&tdcTestHandler);
     timepix3Parser.DataEventObservable<EVRReadout>::subscribe(&evrTestHandler);
-    timepix3Parser.DataEventObservable<PixelReadout>::subscribe(
+    timepix3Parser.DataEventObservable<PixelReadoutBatch>::subscribe(
         &pixelTestHandler);
   }
 
@@ -124,11 +153,44 @@ protected:
 // Test cases below
 
 TEST_F(Timepix3ParserTest, SinglePixelReadout) {
-  pixelTestHandler.setData(singlePixelReadout);
+  PixelReadoutBatch Expected;
+  Expected.push_back(singlePixelReadout);
+  pixelTestHandler.setData(Expected);
   auto Res = timepix3Parser.parse((char *)singlePixelReadoutData.data(),
                                   singlePixelReadoutData.size());
   EXPECT_EQ(Res, 1);
   EXPECT_EQ(counters.PixelReadouts, 1);
+  EXPECT_EQ(pixelTestHandler.getApplyDataCalls(), 1);
+}
+
+TEST_F(Timepix3ParserTest, PixelRunIsOneBatch) {
+  std::vector<uint8_t> Data;
+  PixelReadoutBatch Expected;
+  for (int i = 0; i < 1100; i++) {
+    Data.insert(Data.end(), singlePixelReadoutData.begin(),
+                singlePixelReadoutData.end());
+    Expected.push_back(singlePixelReadout);
+  }
+  pixelTestHandler.setData(Expected);
+
+  auto Res = timepix3Parser.parse((char *)Data.data(), Data.size());
+  EXPECT_EQ(Res, 1100);
+  EXPECT_EQ(counters.PixelReadouts, 1100);
+  EXPECT_EQ(pixelTestHandler.getApplyDataCalls(), 1);
+}
+
+TEST_F(Timepix3ParserTest, TDCSplitsPixelBatch) {
+  ReadoutOrderRecorder Recorder;
+  DataParser Parser{counters};
+  Parser.DataEventObservable<TDCReadout>::subscribe(&Recorder);
+  Parser.DataEventObservable<PixelReadoutBatch>::subscribe(&Recorder);
+
+  auto Res = Parser.parse((char *)PixelTDCPixelReadouts.data(),
+                          PixelTDCPixelReadouts.size());
+  EXPECT_EQ(Res, 4);
+  EXPECT_EQ(counters.PixelReadouts, 3);
+  std::vector<std::string> Expected{"pixels 2", "tdc", "pixels 1"};
+  EXPECT_EQ(Recorder.Order, Expected);
 }
 
 TEST_F(Timepix3ParserTest, TDC1RisingReadouts) {
@@ -202,7 +264,9 @@ TEST_F(Timepix3ParserTest, SingleEVRReadout) {
 
 TEST_F(Timepix3ParserTest, TDCAndPixelReadout) {
   tdcTestHandler.setData(tdc1RisingReadout);
-  pixelTestHandler.setData(singlePixelReadout);
+  PixelReadoutBatch Expected;
+  Expected.push_back(singlePixelReadout);
+  pixelTestHandler.setData(Expected);
 
   auto Res = timepix3Parser.parse((char *)TDCAndPixelReadout.data(),
                                   TDCAndPixelReadout.size());
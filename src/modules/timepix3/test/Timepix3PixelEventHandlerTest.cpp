@@ -203,6 +203,59 @@ TEST_F(Timepix3PixelEventHandlerTest, TestPixelIsAfterReset) {
   EXPECT_EQ(serializer.addEventCallCounter, 1);
 }
 
+TEST_F(Timepix3PixelEventHandlerTest, BatchWithoutGlobalTime) {
+  PixelReadoutBatch Batch;
+  Batch.push_back(
+      PixelReadout{TEST_DCOL, TEST_SPIX, TEST_PIX, TEST_DEFAULT_PIXEL_TIME.ToA,
+                   TEST_DEFAULT_PIXEL_TIME.ToT, TEST_DEFAULT_PIXEL_TIME.fToA,
+                   TEST_DEFAULT_PIXEL_TIME.spidrTime});
+  Batch.push_back(
+      PixelReadout{TEST_DCOL, 500, TEST_PIX, TEST_DEFAULT_PIXEL_TIME.ToA,
+                   TEST_DEFAULT_PIXEL_TIME.ToT, TEST_DEFAULT_PIXEL_TIME.fToA,
+                   TEST_DEFAULT_PIXEL_TIME.spidrTime});
+
+  testEventHandler.applyData(Batch);
+  EXPECT_EQ(counters.NoGlobalTime, 1);
+  EXPECT_EQ(counters.InvalidPixelReadout, 1);
+}
+
+TEST_F(Timepix3PixelEventHandlerTest, BatchSameAsSingleReadouts) {
+  serializer.pulseTimeToCompare = TEST_PULSE_TIME_NS;
+  serializer.pixelIdToCompare = TEST_PIXEL_ID;
+  serializer.eventTimeToCompare = TEST_DEFAULT_PIXEL_TIME.getEventTof();
+
+  testEventHandler.applyData(
+      {TEST_PULSE_TIME_NS, TEST_DEFAULT_PIXEL_TIME.tdcClockInPixelTime});
+
+  PixelReadoutBatch Batch;
+  Batch.push_back(
+      PixelReadout{TEST_DCOL, TEST_SPIX, TEST_PIX, TEST_DEFAULT_PIXEL_TIME.ToA,
+                   TEST_DEFAULT_PIXEL_TIME.ToT, TEST_DEFAULT_PIXEL_TIME.fToA,
+                   TEST_DEFAULT_PIXEL_TIME.spidrTime});
+  Batch.push_back(
+      PixelReadout{TEST_DCOL, 500, TEST_PIX, TEST_DEFAULT_PIXEL_TIME.ToA,
+                   TEST_DEFAULT_PIXEL_TIME.ToT, TEST_DEFAULT_PIXEL_TIME.fToA,
+                   TEST_DEFAULT_PIXEL_TIME.spidrTime});
+
+  testEventHandler.applyData(Batch);
+  testEventHandler.pushDataToKafka();
+  EXPECT_EQ(counters.InvalidPixelReadout, 1);
+  EXPECT_EQ(counters.NoGlobalTime, 0);
+  EXPECT_EQ(counters.TofCount, 1);
+  EXPECT_EQ(counters.Events, 1);
+  EXPECT_EQ(serializer.addEventCallCounter, 1);
+
+  // Same readouts one at a time give the same counters and event
+  for (size_t i = 0; i < Batch.size(); i++) {
+    testEventHandler.applyData(Batch[i]);
+  }
+  testEventHandler.pushDataToKafka();
+  EXPECT_EQ(counters.InvalidPixelReadout, 2);
+  EXPECT_EQ(counters.TofCount, 2);
+  EXPECT_EQ(counters.Events, 2);
+  EXPECT_EQ(serializer.addEventCallCounter, 2);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   auto RetVal = RUN_ALL_TESTS();
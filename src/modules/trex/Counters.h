@@ -11,6 +11,7 @@
 
 #include <common/readout/ess/Parser.h>
 #include <common/readout/vmm3/VMM3Parser.h>
+#include <common/reduction/EventBuilder2DFlusher.h>
 
 #include <cinttypes>
 
@@ -37,6 +38,7 @@ struct Counters {
   int64_t ClustersTooLargeGridSpan{0};
   int64_t EventsMatchedClusters{0};
   int64_t PixelErrors{0};
+  struct EventBuilder2DFlusherStats FlushStats;
 
   // Identification of the cause of produce calls
   int64_t ProduceCauseTimeout{0};
@@ -68,6 +68,10 @@ TrexBase::TrexBase(BaseSettings const &settings) : Detector(settings) {
   Stats.create("cluster.matched_wire_only", Counters.ClustersMatchedWireOnly);
   Stats.create("cluster.matched_grid_only", Counters.ClustersMatchedGridOnly);
   Stats.create("cluster.too_large_grid_span", Counters.ClustersTooLargeGridSpan);
+  Stats.create("cluster.builders.flushes", Counters.FlushStats.Flushes);
+  Stats.create("cluster.builders.flushed", Counters.FlushStats.BuildersFlushed);
+  Stats.create("cluster.builders.flushed_last", Counters.FlushStats.LastBuildersFlushed);
+  Stats.create("cluster.builders.deferred_full_flushes", Counters.FlushStats.DeferredFullFlushes);
 
   // Event stats
   Stats.create("events.count", Counters.Events);
@@ -92,8 +96,7 @@ TrexBase::TrexBase(BaseSettings const &settings) : Detector(settings) {
   // Stats.create("memory.cluster_storage.malloc_fallback_count", ClusterPoolStorage::Pool->Stats.MallocFallbackCount);
 
   // clang-format on
-  std::function<void()> inputFunc = [this]() { inputThread(); };
-  AddThreadFunction(inputFunc, "input");
+  addInputThreads();
 
   std::function<void()> processingFunc = [this]() {
     TrexBase::processing_thread();
@@ -114,11 +117,9 @@ void TrexBase::processing_thread() {
   KafkaConfig KafkaCfg(EFUSettings.KafkaConfigFile);
   Producer EventProducer(EFUSettings.KafkaBroker, EFUSettings.KafkaTopic,
                          KafkaCfg.CfgParms, Stats);
-  auto Produce = [&EventProducer](const auto &DataBuffer,
-                                  const auto &Timestamp) {
-    EventProducer.produce(DataBuffer, Timestamp);
-  };
-
+  if (EFUSettings.KafkaThread) {
+    EventProducer.startThread();
+  }
   Producer AdcHistogramProducer(EFUSettings.KafkaBroker, "trex_debug",
                                 KafkaCfg.CfgParms, Stats, "adc");
   auto ProduceMonitor = [&AdcHistogramProducer](auto DataBuffer,
@@ -126,15 +127,19 @@ void TrexBase::processing_thread() {
     AdcHistogramProducer.produce(DataBuffer, Timestamp);
   };
 
-  Serializer =
-      std::make_unique<EV44Serializer>(KafkaBufferSize, "trex", Produce);
+  Serializer = std::make_unique<EV44Serializer>(KafkaBufferSize, "trex",
+                                                EventProducer);
 
   Stats.create("produce.cause.pulse_change",
                Serializer->stats().ProduceRefTimeTriggered);
   Stats.create("produce.cause.max_events_reached",
                Serializer->stats().ProduceTriggeredMaxEvents);
+  Stats.create("produce.zero_copy", Serializer->stats().ProduceZeroCopy);
+  Stats.create("produce.copied", Serializer->stats().ProduceCopied);
 
   TREXInstrument TREX(Counters, EFUSettings, *Serializer, ESSHeaderParser);
+  // Readouts are processed before the ring buffer entry is reused
+  TREX.VMMParser.setInPlace(true);
 
   HistogramSerializer ADCHistSerializer(TREX.ADCHist.needed_buffer_size(),
                                         "TREX");
@@ -152,15 +157,15 @@ void TrexBase::processing_thread() {
 
     auto idle_start = local_clock::now();
 
-    if (InputFifo.pop(DataIndex)) { // There is data in the FIFO - do processing
-      auto DataLen = RxRingbuffer.getDataLength(DataIndex);
+    if (auto RxRing = popInput(DataIndex)) { // There is data - do processing
+      auto DataLen = RxRing->getDataLength(DataIndex);
       if (DataLen == 0) {
         ITCounters.FifoSeqErrors++;
         continue;
       }
 
       /// \todo use the Buffer<T> class here and in parser
-      auto DataPtr = RxRingbuffer.getDataBuffer(DataIndex);
+      auto DataPtr = RxRing->getDataBuffer(DataIndex);
 
       auto Res = ESSHeaderParser.validate(DataPtr, DataLen, DetectorType::TREX);
 
@@ -178,15 +183,16 @@ void TrexBase::processing_thread() {
       Counters.VMMStats = TREX.VMMParser.Stats;
 
       TREX.processReadouts();
+      Counters.FlushStats = TREX.Flusher.Stats;
 
-      for (auto &builder : TREX.builders) {
-        TREX.generateEvents(builder.Events);
+      for (auto Index : TREX.Flusher.flushed()) {
+        TREX.generateEvents(TREX.builders[Index].Events);
       }
 
     } else {
-      // There is NO data in the FIFO - increment idle counter and sleep a
-      // little
-      usleep(100);
+      // There is NO data in the FIFO - increment idle counter and wait
+      // for data
+      waitForInput();
       Counters.ProcessingIdle +=
           std::chrono::duration_cast<std::chrono::microseconds>(
               local_clock::now() - idle_start)
@@ -194,6 +200,16 @@ void TrexBase::processing_thread() {
 
       // Poll Kafka to handle events and delivery reports
       EventProducer.poll(0);
+
+      // Builders waiting for their flush delay are fully flushed also
+      // when no more packets arrive
+      if (TREX.Flusher.pending()) {
+        TREX.Flusher.flush(TREX.builders, false);
+        Counters.FlushStats = TREX.Flusher.Stats;
+        for (auto Index : TREX.Flusher.flushed()) {
+          TREX.generateEvents(TREX.builders[Index].Events);
+        }
+      }
     }
 
     if (ProduceTimer.timeout()) {
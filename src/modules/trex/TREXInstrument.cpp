@@ -86,6 +86,8 @@ void TREXInstrument::loadConfigAndCalib() {
     builder.ClustererY.setMaximumTimeGap(
         Conf.TREXFileParms.MaxClusteringTimeGap);
   }
+  Flusher = EventBuilder2DFlusher(
+      builders.size(), Conf.TREXFileParms.BuilderFlushDelayUs * 1000ULL);
 
   if (Settings.CalibFile != "") {
     XTRACE(INIT, ALW, "Loading and applying calibration file");
@@ -102,7 +104,7 @@ void TREXInstrument::processReadouts() {
           .getRefTimeUInt64()); /// \todo sometimes PrevPulseTime maybe?
 
   XTRACE(DATA, DEB, "processReadouts()");
-  for (const auto &readout : VMMParser.Result) {
+  for (const auto &readout : VMMParser.readouts()) {
 
     // Convert from physical fiber to rings
     uint8_t Ring =
@@ -191,6 +193,7 @@ void TREXInstrument::processReadouts() {
              readout.Channel, xAndzCoord >> 4, xAndzCoord % 16);
       builders[Ring * Conf.MaxFEN + readout.FENId].insert(
           {TimeNS, xAndzCoord, ADC, 0});
+      Flusher.touch(Ring * Conf.MaxFEN + readout.FENId);
 
       //     uint32_t GlobalXChannel = Hybrid * GeometryBase::NumStrips +
       //     readout.Channel; ADCHist.bin_x(GlobalXChannel, ADC);
@@ -210,15 +213,14 @@ void TREXInstrument::processReadouts() {
       XTRACE(DATA, DEB, "Y: Coord %u, Channel %u", yCoord, readout.Channel);
       builders[Ring * Conf.MaxFEN + readout.FENId].insert(
           {TimeNS, yCoord, ADC, 1});
+      Flusher.touch(Ring * Conf.MaxFEN + readout.FENId);
 
       // uint32_t GlobalYChannel = Hybrid * GeometryBase::NumWires +
       // readout.Channel; ADCHist.bin_y(GlobalYChannel, ADC);
     }
   }
 
-  for (auto &builder : builders) {
-    builder.flush(); // Do matching
-  }
+  Flusher.flush(builders, false); // Do matching
 }
 
 void TREXInstrument::generateEvents(std::vector<Event> &Events) {
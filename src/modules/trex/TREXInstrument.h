@@ -18,6 +18,7 @@
 #include <common/readout/vmm3/VMM3Parser.h>
 #include <common/reduction/Event.h>
 #include <common/reduction/EventBuilder2D.h>
+#include <common/reduction/EventBuilder2DFlusher.h>
 #include <logical_geometry/ESSGeometry.h>
 #include <trex/Counters.h>
 #include <trex/TREXBase.h>
@@ -55,6 +56,9 @@ public:
   /// parsed the configuration file and know the number of cassettes
   std::vector<EventBuilder2D> builders; // reinit in ctor
 
+  /// \brief flushes the builders which received hits, reinit in ctor
+  EventBuilder2DFlusher Flusher;
+
   /// \brief parser for VMM3 readout data
   vmm3::VMM3Parser VMMParser;
 
@@ -24,6 +24,7 @@ void Config::applyConfig() {
   assign("SizeX",         TREXFileParms.SizeX);
   assign("SizeY",         TREXFileParms.SizeY);
   assign("SizeZ",         TREXFileParms.SizeZ);
+  assign("BuilderFlushDelayUs", TREXFileParms.BuilderFlushDelayUs);
 
   try {
     auto PanelConfig = root()["Config"];
@@ -47,6 +47,7 @@ public:
     uint16_t DefaultMinADC{50};
     uint16_t MaxMatchingTimeGap{500};
     uint16_t MaxClusteringTimeGap{500};
+    uint32_t BuilderFlushDelayUs{0}; ///< 0 - no deferred full flush
   } TREXFileParms;
 
   // Derived parameters